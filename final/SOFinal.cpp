@@ -1,70 +1,648 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include <deque>
 #include <unordered_set>
 #include <unordered_map>
 #include <list>
+#include <set>
+#include <map>
+#include <fstream>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
 #include <algorithm>
+#include <string>
 
 #include <chrono>
 #include <codecvt>
-#include <windows.h>
 
 #include <cstdlib>
 #include <ctime>
+#include <random>
+#include <cstring>
+#include <cctype>
+#include <cstdint>
+#include <climits>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 
 
-std::mutex mutexImpresora; // Mutex para asegurar exclusión mutua al acceder a la impresora o la cola
-std::condition_variable condicion; // Variable de condición para que los empleados esperen hasta que la impresora esté disponible
-bool impresora_disponible = true; // Bandera que indica si la impresora está libre o en uso
-std::queue<int> cola_espera; // Cola que mantiene el orden de llegada de los empleados que están esperando para imprimir
+// ==== Registro de eventos ====
+// Los módulos no escriben en consola dentro de sus ciclos: anotan eventos binarios de tamaño
+// fijo en un anillo propio de cada hilo, sin bloqueos, y un hilo escritor los vacía en segundo
+// plano. Los eventos se muestran como texto, se guardan en un archivo binario para decodificarlos
+// después, o ambas cosas. En el nivel RESUMEN no se anota nada: cada punto de registro cuesta
+// solo una comparación.
+
+enum NivelRegistro { REGISTRO_RESUMEN, REGISTRO_EVENTOS, REGISTRO_DETALLE };
+
+NivelRegistro nivelRegistro = REGISTRO_EVENTOS;  // Nivel activo (se cambia desde el menú)
+
+// Indica si los eventos de ese nivel se están anotando
+inline bool registrando(NivelRegistro nivel) { return nivelRegistro >= nivel; }
+
+const char* const NOMBRES_NIVEL_REGISTRO[] = {"resumen", "eventos", "detalle"};
+
+// Tipos de evento; el orden debe coincidir con FORMATOS_REGISTRO
+enum TipoRegistro {
+    REG_IMPRESION_ESPERA, REG_IMPRESION_INICIO, REG_IMPRESION_FIN, REG_IMPRESION_COLA,
+    REG_DESPACHO, REG_DESALOJO, REG_DESPACHO_NUCLEO, REG_ROBO,
+    REG_PRODUCE, REG_CONSUME,
+    REG_FILOSOFO_PIENSA, REG_FILOSOFO_COME, REG_FILOSOFO_TERMINA,
+    TOTAL_TIPOS_REGISTRO
+};
+
+// Texto de cada tipo de evento: %a y %b son sus dos enteros y %t su texto corto
+const char* const FORMATOS_REGISTRO[TOTAL_TIPOS_REGISTRO] = {
+    "[IMPRESION] Empleado %a está esperando para imprimir.",
+    "[IMPRESION] Empleado %a está imprimiendo en la impresora %b...",
+    "[IMPRESION] Empleado %a ha terminado de imprimir.",
+    "  >> Empleados esperando: %a",
+    "Ejecutando %t por %a unidades de tiempo.",
+    "Proceso %t desalojado con %a unidades restantes.",
+    "Núcleo %b: ejecutando %t por %a unidades de tiempo.",
+    "Núcleo %a roba %t de la cola del núcleo %b.",
+    "Productor produce: %a",
+    "Consumidor consume: %a",
+    "Filósofo %a está pensando...",
+    "Filósofo %a está comiendo...",
+    "Filósofo %a ha terminado de comer.",
+};
+
+/**
+ * Evento tal como se guarda en memoria y en el archivo binario (48 bytes, little-endian).
+ * El archivo empieza con "REG1" y un uint32 con el tamaño de cada evento.
+ */
+struct EventoRegistro {
+    uint64_t tiempoNs;   // Nanosegundos desde que se creó el registro
+    uint32_t hilo;       // Número asignado al hilo que lo anotó
+    uint16_t tipo;       // TipoRegistro
+    uint16_t reservado;
+    int64_t a, b;        // Datos numéricos del evento
+    char texto[16];      // Texto corto (id de proceso), truncado y terminado en '\0'
+};
+static_assert(sizeof(EventoRegistro) == 48, "formato de registro inesperado");
+
+const char MAGICO_REGISTRO[4] = {'R', 'E', 'G', '1'};
+const size_t CAPACIDAD_ANILLO_REGISTRO = 4096;  // Eventos por hilo antes de esperar al escritor
 
-// Función que imprime el estado actual de los empleados en espera.
-void imprimir_estado_espera() {
-    std::cout << "  >> Empleados esperando: ";
-    std::queue<int> copia = cola_espera;  // Copia temporal para recorrer sin alterar la original
-    while (!copia.empty()) {
-        std::cout << copia.front() << " ";  // Mostrar el ID del primer empleado en espera
-        copia.pop();                        // Avanzar al siguiente
+// Convierte un evento a texto; con tiempo antepone el instante y el hilo que lo anotó
+string formatearEvento(const EventoRegistro& e, bool conTiempo) {
+    char numero[64];
+    string linea;
+    if (conTiempo) {
+        snprintf(numero, sizeof(numero), "[%12.3f ms | hilo %u] ", e.tiempoNs / 1e6, (unsigned)e.hilo);
+        linea = numero;
+    }
+    const char* f = e.tipo < TOTAL_TIPOS_REGISTRO ? FORMATOS_REGISTRO[e.tipo] : "Evento desconocido (%a, %b)";
+    for (; *f; ++f) {
+        if (*f != '%' || (f[1] != 'a' && f[1] != 'b' && f[1] != 't')) {
+            linea += *f;
+            continue;
+        }
+        ++f;
+        if (*f == 't') {
+            linea.append(e.texto, strnlen(e.texto, sizeof(e.texto)));
+        } else {
+            snprintf(numero, sizeof(numero), "%lld", (long long)(*f == 'a' ? e.a : e.b));
+            linea += numero;
+        }
     }
-    std::cout << std::endl;
+    return linea;
 }
 
-void empleado(int id) {
-    // Simular preparación del documento (espera aleatoria)
-    std::this_thread::sleep_for(std::chrono::milliseconds(500 + rand() % 1000));
+/**
+ * Anillo de eventos de un hilo: solo ese hilo escribe y solo el escritor (con su mutex) lee,
+ * así que basta con dos índices atómicos.
+ */
+class AnilloRegistro {
+public:
+    explicit AnilloRegistro(uint32_t hilo)
+        : hilo(hilo), cerrado(false), eventos(CAPACIDAD_ANILLO_REGISTRO), cabeza(0), cola(0) {}
 
-    {
-        std::unique_lock<std::mutex> lock(mutexImpresora);
-        std::cout << "[IMPRESION] Empleado " << id << " está esperando para imprimir." << std::endl;
-        cola_espera.push(id);
-        imprimir_estado_espera();
+    bool poner(const EventoRegistro& e) {
+        size_t c = cola.load(memory_order_relaxed);
+        if (c - cabeza.load(memory_order_acquire) == CAPACIDAD_ANILLO_REGISTRO) return false;
+        eventos[c % CAPACIDAD_ANILLO_REGISTRO] = e;
+        cola.store(c + 1, memory_order_release);
+        return true;
+    }
+
+    void sacarTodo(vector<EventoRegistro>& destino) {
+        size_t h = cabeza.load(memory_order_relaxed);
+        size_t c = cola.load(memory_order_acquire);
+        for (; h != c; ++h) destino.push_back(eventos[h % CAPACIDAD_ANILLO_REGISTRO]);
+        cabeza.store(h, memory_order_release);
+    }
+
+    bool vacio() const { return cabeza.load(memory_order_acquire) == cola.load(memory_order_acquire); }
+
+    const uint32_t hilo;
+    atomic<bool> cerrado;  // El hilo terminó; se descarta cuando quede vacío
+
+private:
+    vector<EventoRegistro> eventos;
+    atomic<size_t> cabeza, cola;
+};
+
+/**
+ * Registro global. anotar() es la única operación del camino caliente: toma la hora, copia el
+ * evento al anillo del hilo y solo se detiene si el anillo está lleno. El hilo escritor arranca
+ * con el primer evento y vacía los anillos cada pocos milisegundos.
+ */
+class RegistroEventos {
+public:
+    RegistroEventos() : inicio(chrono::steady_clock::now()), consola(true), siguienteHilo(0), detener(false) {}
 
-        condicion.wait(lock, [&]() { return impresora_disponible && cola_espera.front() == id; });
+    ~RegistroEventos() {
+        {
+            lock_guard<mutex> lock(mDespertar);
+            detener = true;
+        }
+        cvEscritor.notify_one();
+        if (escritor.joinable()) escritor.join();
+        vaciar();
+    }
 
-        // Toma la impresora
-        impresora_disponible = false;
-        std::cout << "[IMPRESION] Empleado " << id << " está imprimiendo..." << std::endl;
-        cola_espera.pop();
-        imprimir_estado_espera();
+    void anotar(TipoRegistro tipo, int64_t a, int64_t b = 0, const char* texto = "") {
+        AnilloRegistro& anillo = anilloDelHilo();
+        EventoRegistro e;
+        e.tiempoNs = (uint64_t)chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - inicio).count();
+        e.hilo = anillo.hilo;
+        e.tipo = (uint16_t)tipo;
+        e.reservado = 0;
+        e.a = a;
+        e.b = b;
+        strncpy(e.texto, texto, sizeof(e.texto) - 1);
+        e.texto[sizeof(e.texto) - 1] = '\0';
+        while (!anillo.poner(e)) {
+            cvEscritor.notify_one();  // Anillo lleno: se espera a que el escritor lo vacíe
+            this_thread::yield();
+        }
     }
 
-    // Simular impresión (tiempo aleatorio)
-    std::this_thread::sleep_for(std::chrono::milliseconds(1000 + rand() % 2000));
+    // Escribe ya todos los eventos pendientes (se usa antes de mostrar un resumen)
+    void vaciar() {
+        lock_guard<mutex> lock(mEscritura);
+        vector<shared_ptr<AnilloRegistro> > activos;
+        {
+            lock_guard<mutex> l(mHilos);
+            activos = anillos;
+        }
+
+        lote.clear();
+        for (size_t i = 0; i < activos.size(); ++i) activos[i]->sacarTodo(lote);
+        if (lote.empty()) return;
 
-    {
-        std::unique_lock<std::mutex> lock(mutexImpresora);
-        std::cout << "[IMPRESION] Empleado " << id << " ha terminado de imprimir." << std::endl;
-        impresora_disponible = true;
-        imprimir_estado_espera();  // Mostrar quién sigue esperando
-        condicion.notify_all();    // Despertar a todos los que están esperando
+        // Los eventos de distintos hilos se intercalan por tiempo
+        stable_sort(lote.begin(), lote.end(), [](const EventoRegistro& x, const EventoRegistro& y) {
+            return x.tiempoNs < y.tiempoNs;
+        });
+        if (archivo.is_open())
+            archivo.write(reinterpret_cast<const char*>(lote.data()), lote.size() * sizeof(EventoRegistro));
+        if (consola) {
+            for (size_t i = 0; i < lote.size(); ++i) cout << formatearEvento(lote[i], false) << "\n";
+            cout.flush();
+        }
+
+        // Se descartan los anillos de hilos que ya terminaron y no tienen eventos
+        lock_guard<mutex> l(mHilos);
+        for (size_t i = 0; i < anillos.size();) {
+            if (anillos[i]->cerrado.load() && anillos[i]->vacio()) {
+                anillos[i] = anillos.back();
+                anillos.pop_back();
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    // Empieza a guardar los eventos en un archivo binario (cadena vacía para dejar de guardar)
+    bool guardarEn(const string& ruta) {
+        vaciar();
+        lock_guard<mutex> lock(mEscritura);
+        if (archivo.is_open()) archivo.close();
+        if (ruta.empty()) return true;
+        archivo.open(ruta.c_str(), ios::binary | ios::trunc);
+        if (!archivo) return false;
+        uint32_t tam = sizeof(EventoRegistro);
+        archivo.write(MAGICO_REGISTRO, sizeof(MAGICO_REGISTRO));
+        archivo.write(reinterpret_cast<const char*>(&tam), sizeof(tam));
+        return true;
+    }
+
+    bool guardando() const { return archivo.is_open(); }
+
+    // Activa o desactiva la salida de los eventos como texto en consola
+    void mostrarEnConsola(bool activo) {
+        vaciar();
+        lock_guard<mutex> lock(mEscritura);
+        consola = activo;
+    }
+
+    bool enConsola() const { return consola; }
+
+private:
+    // Dueño del anillo de un hilo: lo registra al primer uso y lo marca cerrado al terminar el hilo
+    struct PropietarioAnillo {
+        explicit PropietarioAnillo(RegistroEventos& r) : anillo(r.registrarHilo()) {}
+        ~PropietarioAnillo() { anillo->cerrado.store(true); }
+        shared_ptr<AnilloRegistro> anillo;
+    };
+
+    AnilloRegistro& anilloDelHilo() {
+        thread_local PropietarioAnillo propio(*this);
+        return *propio.anillo;
+    }
+
+    shared_ptr<AnilloRegistro> registrarHilo() {
+        lock_guard<mutex> lock(mHilos);
+        shared_ptr<AnilloRegistro> anillo(new AnilloRegistro(siguienteHilo++));
+        anillos.push_back(anillo);
+        if (!escritor.joinable()) escritor = thread(&RegistroEventos::bucleEscritor, this);
+        return anillo;
+    }
+
+    void bucleEscritor() {
+        unique_lock<mutex> lock(mDespertar);
+        while (!detener) {
+            cvEscritor.wait_for(lock, chrono::milliseconds(20));
+            lock.unlock();
+            vaciar();
+            lock.lock();
+        }
+    }
+
+    chrono::steady_clock::time_point inicio;
+    bool consola;                                   // Mostrar los eventos como texto
+    ofstream archivo;                               // Destino binario (si está abierto)
+    mutex mEscritura;                               // Un solo hilo vacía los anillos a la vez
+    vector<EventoRegistro> lote;                    // Eventos del vaciado en curso
+
+    mutex mHilos;                                   // Protege la lista de anillos
+    vector<shared_ptr<AnilloRegistro> > anillos;
+    uint32_t siguienteHilo;
+
+    mutex mDespertar;
+    condition_variable cvEscritor;
+    bool detener;
+    thread escritor;
+};
+
+RegistroEventos registro;
+
+// Muestra como texto un archivo binario de eventos
+bool decodificarRegistro(const string& ruta, ostream& out) {
+    ifstream in(ruta.c_str(), ios::binary);
+    char magico[sizeof(MAGICO_REGISTRO)];
+    uint32_t tam = 0;
+    in.read(magico, sizeof(magico));
+    in.read(reinterpret_cast<char*>(&tam), sizeof(tam));
+    if (!in || memcmp(magico, MAGICO_REGISTRO, sizeof(magico)) != 0 || tam != sizeof(EventoRegistro)) return false;
+
+    vector<EventoRegistro> bloque(CAPACIDAD_ANILLO_REGISTRO);
+    size_t total = 0;
+    while (in) {
+        in.read(reinterpret_cast<char*>(bloque.data()), bloque.size() * sizeof(EventoRegistro));
+        size_t leidos = (size_t)in.gcount() / sizeof(EventoRegistro);
+        for (size_t i = 0; i < leidos; ++i) out << formatearEvento(bloque[i], true) << "\n";
+        total += leidos;
+    }
+    out << total << " eventos.\n";
+    return true;
+}
+
+
+// ==== Línea de tiempo para Chrome/Perfetto ====
+// Exporta lo que ocurre en cada simulación como eventos de traza de Chrome (JSON), que se
+// abren en chrome://tracing o en ui.perfetto.dev. Cada simulación es un "proceso" del visor y
+// cada núcleo, hilo o política, una pista dentro de él. Los planificadores y el disco usan su
+// reloj virtual (1 unidad = 1 µs en el visor); los hilos reales usan microsegundos desde que se
+// abrió la traza. La escritura es en flujo: cada hilo junta sus eventos en un búfer propio y lo
+// vuelca al archivo al llenarse o al terminar, así que la línea de tiempo nunca está completa
+// en memoria.
+
+string escaparJSON(const string& s) {
+    string r;
+    for (size_t i = 0; i < s.size(); ++i) {
+        char ch = s[i];
+        if (ch == '"' || ch == '\\') { r += '\\'; r += ch; }
+        else if (ch == '\n') r += "\\n";
+        else if ((unsigned char)ch < 0x20) r += ' ';
+        else r += ch;
+    }
+    return r;
+}
+
+const size_t TAM_BUFER_TRAZA = 64 * 1024;  // Bytes de eventos que junta un hilo antes de volcarlos
+
+class TrazaChrome {
+public:
+    TrazaChrome() : abierta(false), siguienteProceso(1), sesion(0) {}
+    // Al salir del programa el búfer del hilo principal ya se volcó al destruirse
+    ~TrazaChrome() { terminar(); }
+
+    // Empieza una traza nueva en 'ruta' (cierra la anterior si había una)
+    bool abrir(const string& ruta) {
+        cerrar();
+        lock_guard<mutex> lock(m);
+        archivo.open(ruta.c_str(), ios::trunc);
+        if (!archivo) return false;
+        // El primer evento va sin coma; todos los demás empiezan con ",\n" y se pueden volcar en cualquier orden
+        archivo << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+                << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"Simulador de kernel\"}}";
+        inicio = chrono::steady_clock::now();
+        sesion.fetch_add(1);
+        abierta.store(true);
+        return true;
+    }
+
+    // Vuelca los eventos del hilo que llama y cierra el arreglo JSON. Lo que otros hilos vivos
+    // tengan en su búfer se descarta: pertenece a esta traza y no debe aparecer en la siguiente
+    void cerrar() {
+        if (!activa()) return;
+        volcar(buferDelHilo());
+        terminar();
+    }
+
+    bool activa() const { return abierta.load(memory_order_relaxed); }
+
+    // Microsegundos reales desde que se abrió la traza (para las pistas de hilos reales)
+    double ahoraUs() const { return chrono::duration<double, micro>(chrono::steady_clock::now() - inicio).count(); }
+
+    // Crea un proceso del visor con ese nombre y devuelve su pid
+    int nuevoProceso(const string& nombre) {
+        int pid = siguienteProceso.fetch_add(1);
+        metadato("process_name", pid, 0, nombre);
+        return pid;
+    }
+
+    void nombrarPista(int pid, int tid, const string& nombre) { metadato("thread_name", pid, tid, nombre); }
+
+    // Intervalo completo (fase "X") en la pista tid del proceso pid
+    void intervalo(int pid, int tid, const string& nombre, const char* categoria, double inicioUs, double duracionUs) {
+        if (!activa()) return;
+        char numeros[128];
+        snprintf(numeros, sizeof(numeros), "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d}",
+                 inicioUs, duracionUs, pid, tid);
+        agregar(string(",\n{\"name\":\"") + escaparJSON(nombre) + "\",\"cat\":\"" + categoria + numeros);
+    }
+
+    // Valor de un contador (fase "C"); el visor lo dibuja como una gráfica escalonada
+    void contador(int pid, const char* nombre, double instanteUs, long long valor) {
+        if (!activa()) return;
+        char evento[192];
+        snprintf(evento, sizeof(evento), ",\n{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":%d,\"args\":{\"valor\":%lld}}",
+                 nombre, instanteUs, pid, valor);
+        agregar(evento);
+    }
+
+private:
+    // Búfer de un hilo: se vuelca al llenarse y cuando el hilo termina. 'sesion' indica la
+    // traza a la que pertenecen sus eventos
+    struct BuferHilo {
+        explicit BuferHilo(TrazaChrome& t) : traza(t), sesion(0) {}
+        ~BuferHilo() { traza.volcar(*this); }
+        TrazaChrome& traza;
+        string texto;
+        unsigned sesion;
+    };
+
+    BuferHilo& buferDelHilo() {
+        thread_local BuferHilo propio(*this);
+        return propio;
+    }
+
+    void metadato(const char* tipo, int pid, int tid, const string& nombre) {
+        if (!activa()) return;
+        char numeros[64];
+        snprintf(numeros, sizeof(numeros), "\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d", pid, tid);
+        agregar(string(",\n{\"name\":\"") + tipo + numeros + ",\"args\":{\"name\":\"" + escaparJSON(nombre) + "\"}}");
+    }
+
+    void agregar(const string& evento) {
+        BuferHilo& bufer = buferDelHilo();
+        unsigned vigente = sesion.load();
+        if (bufer.sesion != vigente) {  // Restos de una traza anterior
+            bufer.texto.clear();
+            bufer.sesion = vigente;
+        }
+        bufer.texto += evento;
+        if (bufer.texto.size() >= TAM_BUFER_TRAZA) volcar(bufer);
+    }
+
+    void terminar() {
+        if (!abierta.exchange(false)) return;
+        lock_guard<mutex> lock(m);
+        archivo << "\n]}\n";
+        archivo.close();
+    }
+
+    void volcar(BuferHilo& bufer) {
+        if (bufer.texto.empty()) return;
+        lock_guard<mutex> lock(m);
+        if (archivo.is_open() && bufer.sesion == sesion.load()) archivo << bufer.texto;
+        bufer.texto.clear();
+    }
+
+    atomic<bool> abierta;
+    atomic<int> siguienteProceso;
+    atomic<unsigned> sesion;  // Número de la traza abierta; cambia en cada abrir()
+    chrono::steady_clock::time_point inicio;
+    mutex m;           // Un volcado a la vez
+    ofstream archivo;
+};
+
+TrazaChrome trazaChrome;
+
+// ==== Sistema de impresión compartida ====
+// Los empleados que esperan forman una cola FIFO donde cada uno tiene su propia variable de
+// condición. Al liberar una impresora, esta se entrega directamente al primero de la cola y
+// solo se despierta a ese empleado, en lugar de despertar a todos con notify_all.
+
+// Parámetros de la simulación de impresión
+struct ConfigImpresion {
+    int empleados;       // Número de empleados (un hilo por empleado en el modo real)
+    int impresoras;      // Impresoras compartidas en el pool
+    int preparacionMinMs, preparacionMaxMs;  // Tiempo para preparar el documento
+    int trabajoMinMs, trabajoMaxMs;          // Duración de cada trabajo de impresión
+    int trabajos;        // Documentos que imprime cada empleado
+    uint64_t semilla;    // Semilla de los flujos aleatorios (uno por empleado)
+};
+
+/**
+ * Flujo pseudoaleatorio independiente por empleado (splitmix64). Ocupa 8 bytes, así que hay
+ * uno por empleado aunque sean cientos de miles, y cada hilo usa el suyo sin compartir estado
+ * (a diferencia de rand()). Con la misma semilla, cada empleado repite su secuencia.
+ */
+class FlujoAleatorio {
+public:
+    FlujoAleatorio(uint64_t semilla, uint64_t flujo) : estado(semilla ^ (flujo * 0xD1B54A32D192ED03ULL)) {}
+
+    uint64_t siguiente() {
+        uint64_t z = (estado += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Entero en [minimo, maximo]
+    int entre(int minimo, int maximo) {
+        return maximo > minimo ? minimo + (int)(siguiente() % (uint64_t)(maximo - minimo + 1)) : minimo;
+    }
+
+private:
+    uint64_t estado;
+};
+
+/**
+ * Spooler con un pool de impresoras y cola de espera justa (FIFO).
+ * Lleva estadísticas de despertares, tiempo en cola y uso de cada impresora.
+ */
+class SpoolerImpresion {
+public:
+    explicit SpoolerImpresion(int impresoras)
+        : inicio(std::chrono::steady_clock::now()), ocupadaDesde(impresoras), tiempoOcupada(impresoras, 0.0),
+          despertares(0), esperas(0), esperaTotal(0.0), esperaMaxima(0.0) {
+        for (int i = impresoras - 1; i >= 0; --i) libres.push_back(i);
+    }
+
+    // Bloquea hasta que el empleado recibe una impresora; devuelve su índice
+    int adquirir(int id) {
+        std::chrono::steady_clock::time_point llegada = std::chrono::steady_clock::now();
+        std::unique_lock<std::mutex> lock(m);
+
+        int impresora;
+        if (!libres.empty() && cola.empty()) {
+            impresora = libres.back();
+            libres.pop_back();
+        } else {
+            if (registrando(REGISTRO_EVENTOS)) registro.anotar(REG_IMPRESION_ESPERA, id);
+            Espera turno(id);
+            cola.push_back(&turno);
+            if (registrando(REGISTRO_DETALLE)) registro.anotar(REG_IMPRESION_COLA, (int64_t)cola.size());
+
+            // Solo este empleado es notificado cuando le entregan una impresora
+            while (turno.impresora == -1) {
+                turno.cv.wait(lock);
+                ++despertares;
+            }
+            impresora = turno.impresora;
+        }
+
+        double espera = std::chrono::duration<double>(std::chrono::steady_clock::now() - llegada).count();
+        ++esperas;
+        esperaTotal += espera;
+        esperaMaxima = std::max(esperaMaxima, espera);
+        ocupadaDesde[impresora] = std::chrono::steady_clock::now();
+        if (registrando(REGISTRO_EVENTOS)) registro.anotar(REG_IMPRESION_INICIO, id, impresora + 1);
+        if (registrando(REGISTRO_DETALLE)) registro.anotar(REG_IMPRESION_COLA, (int64_t)cola.size());
+        return impresora;
+    }
+
+    // Devuelve la impresora; si hay alguien esperando, se la entrega al primero de la cola
+    void liberar(int id, int impresora) {
+        std::lock_guard<std::mutex> lock(m);
+        tiempoOcupada[impresora] += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - ocupadaDesde[impresora]).count();
+        if (registrando(REGISTRO_EVENTOS)) registro.anotar(REG_IMPRESION_FIN, id);
+
+        if (cola.empty()) {
+            libres.push_back(impresora);
+            return;
+        }
+        Espera* siguiente = cola.front();
+        cola.pop_front();
+        siguiente->impresora = impresora;
+        siguiente->cv.notify_one();  // Un solo despertar por liberación
+    }
+
+    void mostrarEstadisticas() const {
+        double total = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        std::cout << "\nTrabajos atendidos: " << esperas << "\n";
+        std::cout << "Despertares de empleados: " << despertares << "\n";
+        std::cout << "Espera promedio en cola: " << (esperas ? esperaTotal / esperas : 0.0) << " s"
+                  << " (máxima " << esperaMaxima << " s)\n";
+        for (size_t i = 0; i < tiempoOcupada.size(); ++i)
+            std::cout << "Utilización impresora " << i + 1 << ": " << (total > 0 ? 100.0 * tiempoOcupada[i] / total : 0.0) << " %\n";
+    }
+
+private:
+    // Lugar de un empleado en la cola, con su propia variable de condición
+    struct Espera {
+        explicit Espera(int id) : id(id), impresora(-1) {}
+        int id;
+        int impresora;                    // Impresora asignada (-1 mientras espera)
+        std::condition_variable cv;
+    };
+
+    std::mutex m;                   // Protege la cola, las impresoras libres y las estadísticas
+    std::deque<Espera*> cola;       // Empleados esperando, en orden de llegada
+    std::vector<int> libres;        // Impresoras disponibles
+    std::chrono::steady_clock::time_point inicio;
+    std::vector<std::chrono::steady_clock::time_point> ocupadaDesde;
+    std::vector<double> tiempoOcupada;  // Segundos de uso de cada impresora
+    long long despertares;          // Veces que un empleado en espera fue despertado
+    long long esperas;              // Trabajos que obtuvieron impresora
+    double esperaTotal, esperaMaxima;
+};
+
+// pidTraza: proceso de la línea de tiempo donde se anotan la espera y el uso de la impresora (-1 sin traza)
+void empleado(int id, SpoolerImpresion& spooler, const ConfigImpresion& cfg, int pidTraza) {
+    FlujoAleatorio azar(cfg.semilla, id);
+    for (int t = 0; t < cfg.trabajos; ++t) {
+        // Simular preparación del documento (espera aleatoria)
+        std::this_thread::sleep_for(std::chrono::milliseconds(azar.entre(cfg.preparacionMinMs, cfg.preparacionMaxMs)));
+
+        double pide = trazaChrome.ahoraUs();
+        int impresora = spooler.adquirir(id);
+        double obtiene = trazaChrome.ahoraUs();
 
+        // Simular impresión (tiempo aleatorio)
+        std::this_thread::sleep_for(std::chrono::milliseconds(azar.entre(cfg.trabajoMinMs, cfg.trabajoMaxMs)));
+
+        spooler.liberar(id, impresora);
+        if (pidTraza >= 0) {
+            trazaChrome.intervalo(pidTraza, id, "Espera impresora", "espera", pide, obtiene - pide);
+            trazaChrome.intervalo(pidTraza, id, "Impresora " + std::to_string(impresora + 1), "retiene", obtiene,
+                                  trazaChrome.ahoraUs() - obtiene);
+        }
+    }
+}
+
+// Lanza un hilo por empleado sobre un pool de impresoras y muestra las estadísticas
+void simularImpresion(const ConfigImpresion& cfg) {
+    std::cout << "=== SISTEMA DE IMPRESION COMPARTIDA ===\n";
+    SpoolerImpresion spooler(cfg.impresoras);
+    int pidTraza = trazaChrome.activa() ? trazaChrome.nuevoProceso("Impresión") : -1;
+    std::vector<std::thread> hilos;
+    for (int i = 1; i <= cfg.empleados; ++i) {
+        if (pidTraza >= 0) trazaChrome.nombrarPista(pidTraza, i, "Empleado " + std::to_string(i));
+        hilos.emplace_back(empleado, i, std::ref(spooler), std::cref(cfg), pidTraza);
     }
+    for (auto& t : hilos)
+        t.join();
+    registro.vaciar();
+    spooler.mostrarEstadisticas();
 }
 
 // ==== Estructura para procesos simulados ====
@@ -72,24 +650,173 @@ void empleado(int id) {
 // Estados posibles de un proceso
 enum EstadoProceso { NUEVO, LISTO, EJECUTANDO, SUSPENDIDO, TERMINADO };
 
-// Estructura que representa un proceso con sus atributos esenciales
+// Registro con los atributos esenciales de un proceso, usado para crearlo o consultarlo
 struct ProcesoSimulado {
     string id;                // Identificador del proceso
     int arrivalTime;         // Tiempo de llegada al sistema
     int burstTime;           // Tiempo total de CPU requerido
     int remainingTime;       // Tiempo restante de CPU
     EstadoProceso estado;    // Estado actual del proceso
+    int nice;                // Prioridad estilo Unix: -20 (más CPU) a 19 (menos CPU)
+};
+
+// ---- Prioridades (nice) ----
+
+const int NICE_MIN = -20, NICE_MAX = 19;
+
+// Peso de cada nice, igual que la tabla del kernel de Linux: cada nivel cambia ~10 % de CPU
+const int PESO_NICE[NICE_MAX - NICE_MIN + 1] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+     9548,  7620,  6100,  4904,  3906,
+     3121,  2501,  1991,  1586,  1277,
+     1024,   820,   655,   526,   423,
+      335,   272,   215,   172,   137,
+      110,    87,    70,    56,    45,
+       36,    29,    23,    18,    15,
+};
+const int PESO_NICE_0 = 1024;
+
+inline int pesoNice(int nice) { return PESO_NICE[max(NICE_MIN, min(NICE_MAX, nice)) - NICE_MIN]; }
+
+// Columnas que cambian mientras los procesos se ejecutan
+struct EstadoProcesos {
+    vector<long long> remainingTime;   // Tiempo restante de CPU
+    vector<EstadoProceso> estado;      // Estado actual
+    vector<long long> completionTime;  // Instante de finalización en la última planificación
+    vector<long long> firstRunTime;    // Instante del primer despacho (-1 si aún no corre)
+};
+
+/**
+ * Tabla de procesos organizada como estructura de arreglos: cada campo caliente vive en su
+ * propio vector contiguo y cada proceso ocupa una ranura fija. Los identificadores se guardan
+ * una sola vez (internados) y un índice hash da la ranura de un id en O(1).
+ * Las ranuras anónimas (cargas generadas) no tienen id propio y se nombran "#ranura".
+ */
+class TablaProcesos {
+public:
+    vector<const string*> id;          // Id internado de cada ranura (nullptr si es anónima)
+    vector<long long> arrivalTime;     // Tiempo de llegada
+    vector<long long> burstTime;       // Tiempo total de CPU requerido
+    vector<int> nice;                  // Prioridad (peso en el planificador CFS)
+    EstadoProcesos dinamico;           // Estado vivo de cada ranura
+
+    size_t size() const { return arrivalTime.size(); }
+
+    // Agrega un proceso y devuelve su ranura
+    int agregar(const ProcesoSimulado& p) {
+        int ranura = (int)size();
+        id.push_back(nullptr);
+        nombrar(ranura, p.id);
+        arrivalTime.push_back(p.arrivalTime);
+        burstTime.push_back(p.burstTime);
+        nice.push_back(p.nice);
+        dinamico.remainingTime.push_back(p.remainingTime);
+        dinamico.estado.push_back(p.estado);
+        dinamico.completionTime.push_back(0);
+        dinamico.firstRunTime.push_back(-1);
+        return ranura;
+    }
+
+    // Agrega un proceso sin id (no pasa por el índice) y devuelve su ranura
+    int agregarAnonimo(long long llegada, long long rafaga) {
+        int ranura = (int)size();
+        id.push_back(nullptr);
+        arrivalTime.push_back(llegada);
+        burstTime.push_back(rafaga);
+        nice.push_back(0);
+        dinamico.remainingTime.push_back(rafaga);
+        dinamico.estado.push_back(NUEVO);
+        dinamico.completionTime.push_back(0);
+        dinamico.firstRunTime.push_back(-1);
+        return ranura;
+    }
+
+    // Asigna el id de una ranura existente; queda como la ranura más reciente con ese id
+    void nombrar(int ranura, const string& clave) {
+        // La clave del mapa es la única copia del id; la ranura apunta a ella
+        unordered_map<string, int>::iterator it = indice.insert(make_pair(clave, ranura)).first;
+        it->second = ranura;
+        id[ranura] = &it->first;
+    }
+
+    // Nombre para mostrar de una ranura
+    string nombre(int ranura) const {
+        return id[ranura] ? *id[ranura] : "#" + to_string(ranura);
+    }
+
+    // Un id no puede estar vacío ni empezar con '#': "#n" está reservado para la ranura anónima n
+    static bool idValido(const string& clave) { return !clave.empty() && clave[0] != '#'; }
+
+    // Ranura del proceso con ese id, o -1 si no existe ("#n" nombra la ranura anónima n)
+    int buscar(const string& clave) const {
+        unordered_map<string, int>::const_iterator it = indice.find(clave);
+        if (it != indice.end()) return it->second;
+        if (clave.size() > 1 && clave[0] == '#') {
+            char* fin;
+            long ranura = strtol(clave.c_str() + 1, &fin, 10);
+            if (*fin == '\0' && ranura >= 0 && (size_t)ranura < size() && !id[ranura]) return (int)ranura;
+        }
+        return -1;
+    }
+
+    // Reserva espacio para n procesos en todas las columnas
+    void reservar(size_t n) {
+        id.reserve(n);
+        arrivalTime.reserve(n);
+        burstTime.reserve(n);
+        nice.reserve(n);
+        dinamico.remainingTime.reserve(n);
+        dinamico.estado.reserve(n);
+        dinamico.completionTime.reserve(n);
+        dinamico.firstRunTime.reserve(n);
+    }
+
+    // Deja la tabla sin procesos
+    void vaciar() {
+        id.clear();
+        arrivalTime.clear();
+        burstTime.clear();
+        nice.clear();
+        dinamico.remainingTime.clear();
+        dinamico.estado.clear();
+        dinamico.completionTime.clear();
+        dinamico.firstRunTime.clear();
+        indice.clear();
+    }
+
+private:
+    unordered_map<string, int> indice;  // id -> ranura más reciente con ese id
 };
 
-// Lista global de procesos simulados
-vector<ProcesoSimulado> procesos;
+// Tabla global de procesos simulados
+TablaProcesos tablaProcesos;
 int tiempoGlobal = 0;  // Tiempo actual del sistema (puede usarse para estadísticas o planificación)
 
+// Con más procesos que esto, las tablas por proceso se omiten y solo se muestran totales
+const size_t MAX_FILAS_PROCESOS = 100;
+
+// Indica si se muestran las filas de cada proceso en los resultados
+bool mostrarFilasPorProceso(size_t procesos) {
+    return registrando(REGISTRO_EVENTOS) && procesos <= MAX_FILAS_PROCESOS;
+}
+
 
-// Crea un nuevo proceso y lo añade a la lista en estado NUEVO.
+// Crea un nuevo proceso y lo añade a la tabla en estado NUEVO.
+// Un id solo puede reutilizarse cuando el proceso anterior con ese id ya terminó.
 
 void crearProceso(string id, int burstTime) {
-    procesos.push_back({id, tiempoGlobal, burstTime, burstTime, NUEVO});
+    if (!TablaProcesos::idValido(id)) {
+        cout << "Id inválido: " << id << " (los ids que empiezan con # nombran procesos sin id).\n";
+        return;
+    }
+    int previo = tablaProcesos.buscar(id);
+    if (previo != -1 && tablaProcesos.dinamico.estado[previo] != TERMINADO) {
+        cout << "Ya existe un proceso activo con id " << id << ".\n";
+        return;
+    }
+    ProcesoSimulado p = {id, tiempoGlobal, burstTime, burstTime, NUEVO, 0};
+    tablaProcesos.agregar(p);
     cout << "Proceso " << id << " creado en estado NUEVO.\n";
 }
 
@@ -97,30 +824,33 @@ void crearProceso(string id, int burstTime) {
 // Muestra por consola todos los procesos y su estado actual.
 
 void mostrarProcesos() {
+    const EstadoProcesos& d = tablaProcesos.dinamico;
+    size_t visibles = min(tablaProcesos.size(), MAX_FILAS_PROCESOS);
     cout << "\nID\tEstado\t\tTiempo restante\n";
-    for (const auto& p : procesos) {
+    for (size_t i = 0; i < visibles; ++i) {
         string estado;
-        switch (p.estado) {
+        switch (d.estado[i]) {
             case NUEVO: estado = "NUEVO"; break;
             case LISTO: estado = "LISTO"; break;
             case EJECUTANDO: estado = "EJECUTANDO"; break;
             case SUSPENDIDO: estado = "SUSPENDIDO"; break;
             case TERMINADO: estado = "TERMINADO"; break;
         }
-        cout << p.id << "\t" << estado << "\t" << p.remainingTime << "\n";
+        cout << tablaProcesos.nombre((int)i) << "\t" << estado << "\t" << d.remainingTime[i] << "\n";
     }
+    if (visibles < tablaProcesos.size())
+        cout << "... y " << tablaProcesos.size() - visibles << " procesos más.\n";
 }
 
 
 // Cambia el estado de un proceso de LISTO a SUSPENDIDO.
 
 void suspenderProceso(string id) {
-    for (auto& p : procesos) {
-        if (p.id == id && p.estado == LISTO) {
-            p.estado = SUSPENDIDO;
-            cout << "Proceso " << id << " suspendido.\n";
-            return;
-        }
+    int r = tablaProcesos.buscar(id);
+    if (r != -1 && tablaProcesos.dinamico.estado[r] == LISTO) {
+        tablaProcesos.dinamico.estado[r] = SUSPENDIDO;
+        cout << "Proceso " << id << " suspendido.\n";
+        return;
     }
     cout << "No se pudo suspender el proceso.\n";
 }
@@ -129,12 +859,11 @@ void suspenderProceso(string id) {
 //Cambia el estado de un proceso de SUSPENDIDO a LISTO.
 
 void reanudarProceso(string id) {
-    for (auto& p : procesos) {
-        if (p.id == id && p.estado == SUSPENDIDO) {
-            p.estado = LISTO;
-            cout << "Proceso " << id << " reanudado.\n";
-            return;
-        }
+    int r = tablaProcesos.buscar(id);
+    if (r != -1 && tablaProcesos.dinamico.estado[r] == SUSPENDIDO) {
+        tablaProcesos.dinamico.estado[r] = LISTO;
+        cout << "Proceso " << id << " reanudado.\n";
+        return;
     }
     cout << "No se pudo reanudar el proceso.\n";
 }
@@ -143,448 +872,6086 @@ void reanudarProceso(string id) {
 //Termina manualmente un proceso, actualizando su estado y tiempo restante.
 
 void terminarProceso(string id) {
-    for (auto& p : procesos) {
-        if (p.id == id && p.estado != TERMINADO) {
-            p.estado = TERMINADO;
-            p.remainingTime = 0;
-            cout << "Proceso " << id << " terminado manualmente.\n";
-            return;
-        }
+    int r = tablaProcesos.buscar(id);
+    if (r != -1 && tablaProcesos.dinamico.estado[r] != TERMINADO) {
+        tablaProcesos.dinamico.estado[r] = TERMINADO;
+        tablaProcesos.dinamico.remainingTime[r] = 0;
+        cout << "Proceso " << id << " terminado manualmente.\n";
+        return;
     }
     cout << "No se pudo terminar el proceso.\n";
 }
 
-// ==== Ejecución de procesos ====
-// Simula la ejecución secuencial de procesos sin aplicar algoritmos avanzados de planificación
-void planificarProcesos() {
-    cout << "\nIniciando planificación (simulada)\n";
+// Cambia la prioridad (nice) de un proceso que aún no termina
+void cambiarNice(string id, int nice) {
+    int r = tablaProcesos.buscar(id);
+    if (r == -1 || tablaProcesos.dinamico.estado[r] == TERMINADO || nice < NICE_MIN || nice > NICE_MAX) {
+        cout << "No se pudo cambiar la prioridad.\n";
+        return;
+    }
+    tablaProcesos.nice[r] = nice;
+    cout << "Proceso " << id << " ahora tiene nice " << nice << " (peso " << pesoNice(nice) << ").\n";
+}
 
-    // Cambiar el estado de todos los procesos NUEVOS a LISTOS
-    for (auto& p : procesos) {
-        if (p.estado == NUEVO) p.estado = LISTO;
+// ==== Generador de cargas sintéticas ====
+// Produce poblaciones grandes de procesos con llegadas y ráfagas aleatorias reproducibles
+// (misma semilla, misma carga). Los procesos se agregan directamente a la tabla como ranuras
+// anónimas, sin construir ids de texto, así que generar millones cuesta solo las columnas.
+
+enum DistribucionLlegadas { LLEGADAS_POISSON, LLEGADAS_RAFAGAS };
+enum DistribucionRafagas { RAFAGA_EXPONENCIAL, RAFAGA_BIMODAL, RAFAGA_PARETO };
+
+struct ConfigCarga {
+    size_t procesos;
+    uint64_t semilla;
+    DistribucionLlegadas llegadas;
+    double tasaLlegada;      // Procesos por unidad de tiempo (en promedio)
+    double tamRafagaMedio;   // Procesos por grupo en las llegadas en ráfagas
+    DistribucionRafagas rafagas;
+    double rafagaMedia;      // Ráfaga de CPU promedio
+};
+
+/**
+ * Fuente de procesos: cada llamada a siguiente() entrega la llegada y la ráfaga del próximo.
+ *  - Poisson: tiempos entre llegadas exponenciales con la tasa indicada.
+ *  - Ráfagas: grupos de tamaño geométrico que llegan juntos; los grupos siguen un proceso de
+ *    Poisson con tasa tasaLlegada / tamRafagaMedio, así la tasa total no cambia.
+ *  - Ráfagas de CPU exponenciales, bimodales (80 % cortas y 20 % largas) o Pareto con
+ *    alfa = 1.5 (cola pesada); las tres tienen la media pedida.
+ */
+class GeneradorCarga {
+public:
+    explicit GeneradorCarga(const ConfigCarga& cfg)
+        : cfg(cfg), rng(cfg.semilla), uniforme(0.0, 1.0), reloj(0.0), restantesGrupo(0) {}
+
+    void siguiente(long long& llegada, long long& rafaga) {
+        if (cfg.llegadas == LLEGADAS_POISSON) {
+            reloj += exponencial(1.0 / cfg.tasaLlegada);
+        } else if (restantesGrupo == 0) {
+            reloj += exponencial(cfg.tamRafagaMedio / cfg.tasaLlegada);
+            // Tamaño geométrico con media tamRafagaMedio (al menos 1)
+            restantesGrupo = 1 + (long long)(log(uniformeAbierta()) / log(1.0 - 1.0 / cfg.tamRafagaMedio));
+        }
+        if (restantesGrupo > 0) --restantesGrupo;
+        llegada = (long long)reloj;
+
+        double duracion;
+        switch (cfg.rafagas) {
+            case RAFAGA_BIMODAL:
+                duracion = uniforme(rng) < 0.8 ? exponencial(cfg.rafagaMedia * 0.5) : exponencial(cfg.rafagaMedia * 3.0);
+                break;
+            case RAFAGA_PARETO: {
+                const double alfa = 1.5;
+                double minimo = cfg.rafagaMedia * (alfa - 1.0) / alfa;
+                duracion = min(minimo / pow(uniformeAbierta(), 1.0 / alfa), cfg.rafagaMedia * 1e6);
+                break;
+            }
+            default:
+                duracion = exponencial(cfg.rafagaMedia);
+        }
+        rafaga = max(1LL, (long long)ceil(duracion));
+    }
+
+private:
+    double uniformeAbierta() {
+        double u;
+        do u = uniforme(rng); while (u <= 0.0);
+        return u;
+    }
+
+    double exponencial(double media) { return -media * log(uniformeAbierta()); }
+
+    ConfigCarga cfg;
+    mt19937_64 rng;
+    uniform_real_distribution<double> uniforme;
+    double reloj;                // Instante de la última llegada (continuo)
+    long long restantesGrupo;    // Procesos que faltan del grupo en curso
+};
+
+// Agrega a la tabla los procesos generados, con llegadas desplazadas a partir de 'inicio'
+void generarCarga(const ConfigCarga& cfg, TablaProcesos& tabla, long long inicio) {
+    GeneradorCarga generador(cfg);
+    tabla.reservar(tabla.size() + cfg.procesos);
+    for (size_t i = 0; i < cfg.procesos; ++i) {
+        long long llegada, rafaga;
+        generador.siguiente(llegada, rafaga);
+        tabla.agregarAnonimo(inicio + llegada, rafaga);
+    }
+}
+
+// Pide la configuración por consola y genera la carga en la tabla global
+void menuGenerarCarga() {
+    ConfigCarga cfg = {100000, 42, LLEGADAS_POISSON, 0.5, 8.0, RAFAGA_EXPONENCIAL, 10.0};
+    int llegadas, rafagas;
+    cout << "Cantidad de procesos: ";
+    cin >> cfg.procesos;
+    cout << "Semilla: ";
+    cin >> cfg.semilla;
+    cout << "Llegadas (1 = Poisson, 2 = en ráfagas): ";
+    cin >> llegadas;
+    cout << "Procesos que llegan por unidad de tiempo: ";
+    cin >> cfg.tasaLlegada;
+    if (llegadas == 2) {
+        cout << "Procesos por ráfaga (promedio): ";
+        cin >> cfg.tamRafagaMedio;
+    }
+    cout << "Ráfagas de CPU (1 = exponencial, 2 = bimodal, 3 = Pareto): ";
+    cin >> rafagas;
+    cout << "Ráfaga promedio: ";
+    cin >> cfg.rafagaMedia;
+    if (cfg.procesos < 1 || llegadas < 1 || llegadas > 2 || rafagas < 1 || rafagas > 3 || cfg.tasaLlegada <= 0
+        || cfg.tamRafagaMedio < 1 || cfg.rafagaMedia <= 0) {
+        cout << "Configuración inválida.\n";
+        return;
+    }
+    cfg.llegadas = (DistribucionLlegadas)(llegadas - 1);
+    cfg.rafagas = (DistribucionRafagas)(rafagas - 1);
+
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    generarCarga(cfg, tablaProcesos, tiempoGlobal);
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    cout << cfg.procesos << " procesos generados en " << segundos << " s (ids #ranura).\n";
+    if (cfg.procesos > MAX_FILAS_PROCESOS)
+        cout << "Para cargas grandes conviene el nivel resumen del registro de eventos.\n";
+}
+
+// ==== Métricas de planificación ====
+// Histogramas con cubetas logarítmicas (al estilo HDR): cada potencia de 2 se divide en
+// 2^BITS_SUBCUBETA subcubetas, así que registrar un valor cuesta O(1), la memoria es fija
+// sin importar cuántos procesos haya y el error relativo de los percentiles es menor a 1/32.
+
+// Posición del bit encendido más alto (mapa distinto de cero)
+inline int bitMasAlto(uint64_t mapa) {
+#ifdef _MSC_VER
+    unsigned long indice;
+    _BitScanReverse64(&indice, mapa);
+    return (int)indice;
+#else
+    return 63 - __builtin_clzll(mapa);
+#endif
+}
+
+class HistogramaLog {
+public:
+    static const int BITS_SUBCUBETA = 5;
+    static const uint64_t SUBCUBETAS = 1ULL << BITS_SUBCUBETA;
+
+    HistogramaLog() : conteos((64 - BITS_SUBCUBETA + 1) * SUBCUBETAS, 0), cuenta(0), suma(0), minimo(0), maximo(0) {}
+
+    // Registra un valor (los negativos cuentan como 0)
+    void registrar(long long valor) {
+        uint64_t v = valor > 0 ? (uint64_t)valor : 0;
+        ++conteos[indice(v)];
+        minimo = cuenta == 0 ? v : min(minimo, v);
+        maximo = max(maximo, v);
+        ++cuenta;
+        suma += v;
+    }
+
+    // Suma los valores de otro histograma (por ejemplo, de otra corrida en paralelo)
+    void combinar(const HistogramaLog& otro) {
+        if (otro.cuenta == 0) return;
+        for (size_t i = 0; i < conteos.size(); ++i) conteos[i] += otro.conteos[i];
+        minimo = cuenta == 0 ? otro.minimo : min(minimo, otro.minimo);
+        maximo = max(maximo, otro.maximo);
+        cuenta += otro.cuenta;
+        suma += otro.suma;
+    }
+
+    // Menor valor v tal que al menos la fracción q (0..1) de los registros es <= v.
+    // Devuelve el tope de su cubeta, acotado por el máximo observado
+    uint64_t percentil(double q) const {
+        if (cuenta == 0) return 0;
+        uint64_t objetivo = max<uint64_t>(1, (uint64_t)ceil(q * cuenta));
+        uint64_t acumulado = 0;
+        for (size_t i = 0; i < conteos.size(); ++i) {
+            acumulado += conteos[i];
+            if (acumulado >= objetivo) return min(maximo, topeCubeta(i));
+        }
+        return maximo;
+    }
+
+    uint64_t total() const { return cuenta; }
+    uint64_t menor() const { return minimo; }
+    uint64_t mayor() const { return maximo; }
+    double promedio() const { return cuenta ? (double)suma / cuenta : 0.0; }
+
+private:
+    // Los valores menores a 2 * SUBCUBETAS se guardan exactos; los demás, con la mantisa recortada
+    static size_t indice(uint64_t v) {
+        if (v < 2 * SUBCUBETAS) return (size_t)v;
+        int corrimiento = bitMasAlto(v) - BITS_SUBCUBETA;
+        return (size_t)(corrimiento * SUBCUBETAS + (v >> corrimiento));
+    }
+
+    // Mayor valor que cae en la cubeta i
+    static uint64_t topeCubeta(size_t i) {
+        if (i < 2 * SUBCUBETAS) return i;
+        int corrimiento = (int)(i / SUBCUBETAS) - 1;
+        uint64_t mantisa = i - corrimiento * SUBCUBETAS;
+        return ((mantisa + 1) << corrimiento) - 1;
+    }
+
+    vector<uint64_t> conteos;
+    uint64_t cuenta;
+    uint64_t suma;
+    uint64_t minimo, maximo;
+};
+
+// Métricas de una corrida del planificador. Los motores las actualizan en O(1) por evento
+// y las de varias corridas independientes se pueden combinar en una sola.
+struct MetricasPlanificacion {
+    HistogramaLog espera, retorno, respuesta;
+    long long tiempo;           // Duración simulada (sumada entre corridas)
+    long long capacidad;        // Tiempo de CPU disponible: duración por número de núcleos
+    long long ocupado;          // Tiempo de CPU ejecutando procesos
+    long long terminados;
+    long long despachos;
+    long long cambiosContexto;  // Despachos de un proceso distinto al último que usó esa CPU
+    long long desalojos;
+
+    MetricasPlanificacion()
+        : tiempo(0), capacidad(0), ocupado(0), terminados(0), despachos(0), cambiosContexto(0), desalojos(0) {}
+
+    // Un proceso llegado en 'llegada' que necesitaba 'rafaga' unidades terminó en 'fin'
+    void registrarFin(long long llegada, long long rafaga, long long fin) {
+        retorno.registrar(fin - llegada);
+        espera.registrar(fin - llegada - rafaga);
+        ++terminados;
+    }
+
+    void combinar(const MetricasPlanificacion& otra) {
+        espera.combinar(otra.espera);
+        retorno.combinar(otra.retorno);
+        respuesta.combinar(otra.respuesta);
+        tiempo += otra.tiempo;
+        capacidad += otra.capacidad;
+        ocupado += otra.ocupado;
+        terminados += otra.terminados;
+        despachos += otra.despachos;
+        cambiosContexto += otra.cambiosContexto;
+        desalojos += otra.desalojos;
+    }
+
+    // Procesos terminados por unidad de tiempo
+    double rendimiento() const { return tiempo > 0 ? (double)terminados / tiempo : 0.0; }
+    double utilizacion() const { return capacidad > 0 ? (double)ocupado / capacidad : 0.0; }
+};
+
+// Muestra promedio y percentiles de espera, retorno y respuesta, y los contadores de la corrida
+void mostrarMetricas(const MetricasPlanificacion& m) {
+    const HistogramaLog* h[] = {&m.espera, &m.retorno, &m.respuesta};
+    const char* nombres[] = {"Espera\t", "Retorno\t", "Respuesta"};
+    cout << "\nMétrica\t\tPromedio\tp50\tp90\tp99\tp99.9\tMáximo\n";
+    for (int i = 0; i < 3; ++i) {
+        cout << nombres[i] << "\t" << h[i]->promedio() << "\t\t" << h[i]->percentil(0.50) << "\t"
+             << h[i]->percentil(0.90) << "\t" << h[i]->percentil(0.99) << "\t" << h[i]->percentil(0.999) << "\t"
+             << h[i]->mayor() << "\n";
+    }
+    cout << "Rendimiento: " << m.rendimiento() << " procesos por unidad de tiempo\n";
+    cout << "Utilización de CPU: " << 100.0 * m.utilizacion() << " %\n";
+    cout << "Despachos: " << m.despachos << ", cambios de contexto: " << m.cambiosContexto
+         << ", desalojos: " << m.desalojos << "\n";
+}
+
+// ==== Motor de simulación por eventos discretos ====
+// Todas las políticas de planificación se ejecutan sobre un reloj virtual: el tiempo avanza
+// saltando de evento en evento, así que la simulación corre tan rápido como lo permita la CPU.
+// El modo visual agrega pausas reales entre despachos para las demostraciones en clase.
+
+bool modoVisual = false;   // Si está activo, cada despacho espera pausaVisualMs milisegundos reales
+int pausaVisualMs = 300;   // Duración de la pausa del modo visual
+
+// Pausa real solo cuando el modo visual está activo
+void pausaVisual() {
+    if (modoVisual) {
+        registro.vaciar();  // El despacho se muestra antes de la pausa
+        this_thread::sleep_for(chrono::milliseconds(pausaVisualMs));
+    }
+}
+
+// Tipos de eventos que maneja el motor
+enum TipoEvento { EVENTO_LLEGADA, EVENTO_FIN_RAFAGA };
+
+struct Evento {
+    long long tiempo;      // Instante virtual en que ocurre el evento
+    long long secuencia;   // Orden de creación, desempata eventos simultáneos
+    TipoEvento tipo;
+    int proceso;           // Ranura del proceso en la tabla
+    int nucleo;            // Núcleo del fin de ráfaga (motor multinúcleo)
+};
+
+// Orden de la cola de eventos: primero el menor tiempo y, a igual tiempo, el más antiguo
+struct CompararEventos {
+    bool operator()(const Evento& a, const Evento& b) const {
+        if (a.tiempo != b.tiempo) return a.tiempo > b.tiempo;
+        return a.secuencia > b.secuencia;
+    }
+};
+
+// Lo que el motor y las políticas ven durante una planificación: datos fijos y estado vivo
+struct Corrida {
+    const TablaProcesos& tabla;
+    EstadoProcesos& estado;
+};
+
+/**
+ * Interfaz que implementa cada algoritmo de planificación.
+ * El motor le avisa cuando un proceso queda listo y le pide el siguiente a despachar.
+ * Los procesos se identifican por su ranura en la tabla de procesos.
+ */
+class PoliticaPlanificacion {
+public:
+    virtual ~PoliticaPlanificacion() {}
+
+    virtual string nombre() const = 0;
+
+    // Un proceso llega o vuelve a la cola de listos
+    virtual void agregarListo(int proceso, const Corrida& c) = 0;
+
+    // Retira el siguiente proceso a ejecutar (-1 si no hay ninguno listo)
+    virtual int siguiente(const Corrida& c) = 0;
+
+    // Tiempo máximo de CPU que recibe el proceso despachado antes de devolverla
+    virtual long long rebanada(int proceso, const Corrida& c) = 0;
+
+    // Indica si un proceso que llega puede quitarle la CPU al que está ejecutando
+    virtual bool expropiativa() const { return false; }
+
+    // Decide si el proceso en CPU (al que le quedan 'restante' unidades) debe ser desalojado
+    virtual bool debeDesalojar(int, long long, const Corrida&) { return false; }
+
+    // Retira un proceso para que lo ejecute otro núcleo (robo de trabajo); por defecto el siguiente
+    virtual int robar(const Corrida& c) { return siguiente(c); }
+
+    // El motor avisa cada vez que avanza el reloj (para políticas con eventos periódicos)
+    virtual void actualizarReloj(long long) {}
+};
+
+/**
+ * Motor de eventos discretos con reloj virtual.
+ * Trabaja directamente sobre la tabla de procesos: actualiza en su lugar el tiempo restante,
+ * el estado y el instante de finalización de las ranuras indicadas.
+ */
+class SimuladorEventos {
+public:
+    SimuladorEventos(const Corrida& corrida, const vector<int>& ranuras, PoliticaPlanificacion& politica, long long inicio)
+        : c(corrida), ranuras(ranuras), politica(politica), reloj(inicio), secuencia(0), actual(-1), anterior(-1),
+          rebanadaActual(0), inicioRebanada(0), finVigente(-1), pidTraza(-1), listos(0), listosTrazados(-1) {}
+
+    // Ejecuta la simulación hasta vaciar la cola de eventos y devuelve el tiempo final
+    long long ejecutar() {
+        long long inicio = reloj;
+        if (trazaChrome.activa()) {
+            pidTraza = trazaChrome.nuevoProceso("Planificación " + politica.nombre());
+            trazaChrome.nombrarPista(pidTraza, 0, "CPU");
+        }
+        for (size_t i = 0; i < ranuras.size(); ++i)
+            programar(max(reloj, c.tabla.arrivalTime[ranuras[i]]), EVENTO_LLEGADA, ranuras[i]);
+
+        while (!eventos.empty()) {
+            reloj = eventos.top().tiempo;
+            politica.actualizarReloj(reloj);
+
+            // Procesar todos los eventos del mismo instante antes de despachar
+            while (!eventos.empty() && eventos.top().tiempo == reloj) {
+                Evento e = eventos.top();
+                eventos.pop();
+                atender(e);
+            }
+
+            if (actual != -1 && politica.expropiativa())
+                revisarDesalojo();
+            if (actual == -1)
+                despachar();
+            if (pidTraza >= 0 && listos != listosTrazados) {
+                trazaChrome.contador(pidTraza, "Cola de listos", (double)reloj, listos);
+                listosTrazados = listos;
+            }
+        }
+        metricas.tiempo = metricas.capacidad = reloj - inicio;
+        return reloj;
+    }
+
+    const MetricasPlanificacion& resultados() const { return metricas; }
+
+private:
+    long long programar(long long tiempo, TipoEvento tipo, int proceso) {
+        Evento e = {tiempo, secuencia++, tipo, proceso, 0};
+        eventos.push(e);
+        return e.secuencia;
+    }
+
+    void atender(const Evento& e) {
+        if (e.tipo == EVENTO_LLEGADA) {
+            c.estado.estado[e.proceso] = LISTO;
+            politica.agregarListo(e.proceso, c);
+            ++listos;
+            return;
+        }
+
+        // Un fin de ráfaga anulado por un desalojo se descarta
+        if (e.secuencia != finVigente) return;
+
+        // Fin de la ráfaga del proceso en CPU
+        int p = e.proceso;
+        c.estado.remainingTime[p] -= rebanadaActual;
+        metricas.ocupado += rebanadaActual;
+        actual = -1;
+        trazarRebanada(p);
+
+        if (c.estado.remainingTime[p] == 0) {
+            c.estado.completionTime[p] = reloj;
+            c.estado.estado[p] = TERMINADO;
+            metricas.registrarFin(c.tabla.arrivalTime[p], c.tabla.burstTime[p], reloj);
+        } else {
+            c.estado.estado[p] = LISTO;
+            politica.agregarListo(p, c);  // Vuelve a la cola de listos
+            ++listos;
+        }
+    }
+
+    void despachar() {
+        int p = politica.siguiente(c);
+        if (p == -1) return;  // CPU ociosa hasta el próximo evento
+
+        --listos;
+        actual = p;
+        c.estado.estado[p] = EJECUTANDO;
+        if (c.estado.firstRunTime[p] < 0) {
+            c.estado.firstRunTime[p] = reloj;
+            metricas.respuesta.registrar(reloj - c.tabla.arrivalTime[p]);
+        }
+        ++metricas.despachos;
+        if (p != anterior) ++metricas.cambiosContexto;
+        anterior = p;
+        rebanadaActual = politica.rebanada(p, c);
+        if (registrando(REGISTRO_EVENTOS))
+            registro.anotar(REG_DESPACHO, rebanadaActual, 0, c.tabla.nombre(p).c_str());
+        pausaVisual();
+        inicioRebanada = reloj;
+        finVigente = programar(reloj + rebanadaActual, EVENTO_FIN_RAFAGA, p);
+    }
+
+    // Con políticas expropiativas, una llegada puede interrumpir la ráfaga en curso
+    void revisarDesalojo() {
+        long long restante = c.estado.remainingTime[actual] - (reloj - inicioRebanada);
+        if (!politica.debeDesalojar(actual, restante, c)) return;
+
+        if (registrando(REGISTRO_EVENTOS))
+            registro.anotar(REG_DESALOJO, restante, 0, c.tabla.nombre(actual).c_str());
+        c.estado.remainingTime[actual] = restante;
+        c.estado.estado[actual] = LISTO;
+        metricas.ocupado += reloj - inicioRebanada;
+        ++metricas.desalojos;
+        trazarRebanada(actual);
+        finVigente = -1;  // El fin de ráfaga ya programado queda sin efecto
+        politica.agregarListo(actual, c);
+        ++listos;
+        actual = -1;
+    }
+
+    // Anota en la línea de tiempo la rebanada que termina ahora (por fin de ráfaga o desalojo)
+    void trazarRebanada(int p) {
+        if (pidTraza >= 0)
+            trazaChrome.intervalo(pidTraza, 0, c.tabla.nombre(p), "cpu", (double)inicioRebanada, (double)(reloj - inicioRebanada));
+    }
+
+    Corrida c;
+    const vector<int>& ranuras;  // Procesos que participan en la planificación
+    PoliticaPlanificacion& politica;
+    priority_queue<Evento, vector<Evento>, CompararEventos> eventos;
+    long long reloj;           // Reloj virtual
+    long long secuencia;       // Contador para desempatar eventos
+    int actual;                // Proceso en CPU (-1 si está libre)
+    int anterior;              // Último proceso que usó la CPU
+    long long rebanadaActual;  // Duración de la ráfaga en curso
+    long long inicioRebanada;  // Instante en que empezó la ráfaga en curso
+    long long finVigente;      // Secuencia del fin de ráfaga válido (-1 si no hay)
+    int pidTraza;              // Proceso de la línea de tiempo (-1 sin traza)
+    long long listos;          // Procesos en la cola de listos
+    long long listosTrazados;  // Último valor anotado en la línea de tiempo
+    MetricasPlanificacion metricas;
+};
+
+// ---- Políticas ----
+
+// First-Come, First-Served: ejecuta cada proceso completo en orden de llegada
+class PoliticaFCFS : public PoliticaPlanificacion {
+public:
+    string nombre() const { return "FCFS"; }
+    void agregarListo(int proceso, const Corrida&) { listos.push_back(proceso); }
+    int siguiente(const Corrida&) {
+        if (listos.empty()) return -1;
+        int p = listos.front();
+        listos.pop_front();
+        return p;
+    }
+    // El ladrón toma el último en llegar, el que más tardaría en correr aquí
+    int robar(const Corrida&) {
+        if (listos.empty()) return -1;
+        int p = listos.back();
+        listos.pop_back();
+        return p;
+    }
+    long long rebanada(int proceso, const Corrida& c) { return c.estado.remainingTime[proceso]; }
+private:
+    deque<int> listos;
+};
+
+// Round Robin: cada proceso recibe como máximo un quantum y vuelve al final de la cola
+class PoliticaRoundRobin : public PoliticaPlanificacion {
+public:
+    explicit PoliticaRoundRobin(int quantum) : quantum(quantum) {}
+    string nombre() const { return "Round Robin"; }
+    void agregarListo(int proceso, const Corrida&) { listos.push_back(proceso); }
+    int siguiente(const Corrida&) {
+        if (listos.empty()) return -1;
+        int p = listos.front();
+        listos.pop_front();
+        return p;
+    }
+    // El ladrón toma el último en llegar, el que más tardaría en correr aquí
+    int robar(const Corrida&) {
+        if (listos.empty()) return -1;
+        int p = listos.back();
+        listos.pop_back();
+        return p;
+    }
+    long long rebanada(int proceso, const Corrida& c) {
+        return min<long long>(quantum, c.estado.remainingTime[proceso]);
+    }
+private:
+    int quantum;
+    deque<int> listos;
+};
+
+// Cola de listos ordenada por una clave de tiempo (menor primero, a igualdad el de menor ranura).
+// El montículo hace que admitir y elegir cuesten O(log n), así que n procesos cuestan O(n log n).
+typedef pair<long long, int> EntradaListos;
+typedef priority_queue<EntradaListos, vector<EntradaListos>, greater<EntradaListos> > MonticuloListos;
+
+// Shortest Job First sin desalojo: entre los procesos que ya llegaron elige la menor ráfaga
+class PoliticaSJF : public PoliticaPlanificacion {
+public:
+    string nombre() const { return "SJF"; }
+    void agregarListo(int proceso, const Corrida& c) {
+        listos.push(EntradaListos(c.tabla.burstTime[proceso], proceso));
+    }
+    int siguiente(const Corrida&) {
+        if (listos.empty()) return -1;
+        int p = listos.top().second;
+        listos.pop();
+        return p;
+    }
+    long long rebanada(int proceso, const Corrida& c) { return c.estado.remainingTime[proceso]; }
+private:
+    MonticuloListos listos;
+};
+
+// Shortest Remaining Time First: SJF con desalojo cuando llega un proceso con menos tiempo restante
+class PoliticaSRTF : public PoliticaPlanificacion {
+public:
+    string nombre() const { return "SRTF"; }
+    void agregarListo(int proceso, const Corrida& c) {
+        listos.push(EntradaListos(c.estado.remainingTime[proceso], proceso));
+    }
+    int siguiente(const Corrida&) {
+        if (listos.empty()) return -1;
+        int p = listos.top().second;
+        listos.pop();
+        return p;
+    }
+    long long rebanada(int proceso, const Corrida& c) { return c.estado.remainingTime[proceso]; }
+    bool expropiativa() const { return true; }
+    bool debeDesalojar(int, long long restante, const Corrida&) {
+        return !listos.empty() && listos.top().first < restante;
+    }
+private:
+    MonticuloListos listos;
+};
+
+// Índice del bit encendido más bajo de un mapa distinto de cero (find-first-set)
+inline int primerBitEncendido(uint64_t mapa) {
+#ifdef _MSC_VER
+    unsigned long indice;
+    _BitScanForward64(&indice, mapa);
+    return (int)indice;
+#else
+    return __builtin_ctzll(mapa);
+#endif
+}
+
+/**
+ * Multi-Level Feedback Queue: una cola Round Robin por nivel, de mayor a menor prioridad,
+ * con quantum propio en cada nivel. Un proceso nuevo entra al nivel 0; si agota su quantum
+ * baja un nivel, y si cede la CPU antes (desalojo) conserva el suyo. Cada periodoBoost
+ * unidades todos vuelven al nivel 0 para que los procesos largos no sufran inanición.
+ * Un mapa de bits marca los niveles con procesos listos, así elegir el siguiente es O(1).
+ */
+class PoliticaMLFQ : public PoliticaPlanificacion {
+public:
+    static const int MAX_NIVELES = 64;  // Un bit del mapa por nivel
+
+    PoliticaMLFQ(const vector<long long>& quantums, long long periodoBoost)
+        : quantums(quantums), colas(quantums.size()), mapa(0), periodoBoost(periodoBoost),
+          proximoBoost(periodoBoost), epoca(0), inicializado(false) {}
+
+    string nombre() const { return "MLFQ"; }
+
+    void agregarListo(int proceso, const Corrida& c) {
+        asegurarTamano(c);
+        int n = nivelDe(proceso);
+        if (despachado[proceso]) {
+            // Vuelve de la CPU: si usó todo su quantum baja de nivel, salvo que un boost
+            // ocurrido mientras ejecutaba ya lo haya devuelto al nivel 0
+            despachado[proceso] = false;
+            long long usado = restanteAlDespachar[proceso] - c.estado.remainingTime[proceso];
+            if (epocaNivel[proceso] == epoca && usado >= quantums[n] && n + 1 < (int)quantums.size()) ++n;
+        }
+        nivel[proceso] = n;
+        epocaNivel[proceso] = epoca;
+        colas[n].push_back(proceso);
+        mapa |= 1ULL << n;
+    }
+
+    int siguiente(const Corrida&) {
+        if (!mapa) return -1;
+        int n = primerBitEncendido(mapa);
+        int p = colas[n].front();
+        colas[n].pop_front();
+        if (colas[n].empty()) mapa &= ~(1ULL << n);
+        return p;
+    }
+
+    long long rebanada(int proceso, const Corrida& c) {
+        despachado[proceso] = true;
+        restanteAlDespachar[proceso] = c.estado.remainingTime[proceso];
+        return min(quantums[nivelDe(proceso)], c.estado.remainingTime[proceso]);
+    }
+
+    // Un proceso de mayor prioridad que llega le quita la CPU al que está ejecutando
+    bool expropiativa() const { return true; }
+    bool debeDesalojar(int proceso, long long, const Corrida&) {
+        return mapa && primerBitEncendido(mapa) < nivelDe(proceso);
+    }
+
+    void actualizarReloj(long long ahora) {
+        if (periodoBoost <= 0 || ahora < proximoBoost) return;
+        // Todos los niveles pasan al 0 conservando su orden; los que no están en cola
+        // (en CPU) se reinician al cambiar de época, sin recorrer la tabla
+        for (size_t n = 1; n < colas.size(); ++n) {
+            colas[0].insert(colas[0].end(), colas[n].begin(), colas[n].end());
+            colas[n].clear();
+        }
+        if (!colas[0].empty()) mapa = 1;
+        ++epoca;
+        for (size_t i = 0; i < colas[0].size(); ++i) epocaNivel[colas[0][i]] = epoca, nivel[colas[0][i]] = 0;
+        proximoBoost += ((ahora - proximoBoost) / periodoBoost + 1) * periodoBoost;
+    }
+
+private:
+    // Nivel vigente: si hubo un boost desde que se asignó, el proceso está en el nivel 0
+    int nivelDe(int proceso) const { return epocaNivel[proceso] == epoca ? nivel[proceso] : 0; }
+
+    void asegurarTamano(const Corrida& c) {
+        if (inicializado && nivel.size() >= c.tabla.size()) return;
+        nivel.resize(c.tabla.size(), 0);
+        epocaNivel.resize(c.tabla.size(), epoca);
+        despachado.resize(c.tabla.size(), false);
+        restanteAlDespachar.resize(c.tabla.size(), 0);
+        inicializado = true;
+    }
+
+    vector<long long> quantums;        // Quantum de cada nivel
+    vector<deque<int> > colas;         // Cola Round Robin de cada nivel
+    uint64_t mapa;                     // Bit n encendido si la cola n tiene procesos
+    long long periodoBoost;            // Cada cuánto todos vuelven al nivel 0 (0 = nunca)
+    long long proximoBoost;
+    long long epoca;                   // Boosts realizados
+    bool inicializado;
+    vector<int> nivel;                 // Nivel de cada ranura (válido si su época es la actual)
+    vector<long long> epocaNivel;
+    vector<bool> despachado;           // La ranura está en CPU (para saber si agotó el quantum)
+    vector<long long> restanteAlDespachar;
+};
+
+/**
+ * Planificador equitativo al estilo CFS de Linux. Cada proceso acumula tiempo virtual de CPU
+ * (vruntime) que avanza más lento cuanto mayor es su peso, y siempre se elige el de menor
+ * vruntime. Los listos viven en un árbol rojo-negro (std::set) ordenado por vruntime, así que
+ * elegir, agregar y quitar cuestan O(log n). La rebanada reparte la latencia objetivo entre los
+ * listos según su peso, sin bajar de la granularidad mínima.
+ */
+class PoliticaCFS : public PoliticaPlanificacion {
+public:
+    PoliticaCFS(long long latenciaObjetivo, long long granularidadMinima)
+        : latenciaObjetivo(latenciaObjetivo), granularidadMinima(granularidadMinima), pesoListos(0), minVruntime(0) {}
+
+    string nombre() const { return "CFS"; }
+
+    void agregarListo(int proceso, const Corrida& c) {
+        if (vruntime.size() < c.tabla.size()) {
+            vruntime.resize(c.tabla.size(), -1);
+            restanteAlDespachar.resize(c.tabla.size(), -1);
+        }
+        int peso = pesoNice(c.tabla.nice[proceso]);
+        if (restanteAlDespachar[proceso] >= 0) {
+            // Vuelve de la CPU: se cobra el tiempo usado, escalado por el peso
+            long long usado = restanteAlDespachar[proceso] - c.estado.remainingTime[proceso];
+            vruntime[proceso] += usado * ESCALA * PESO_NICE_0 / peso;
+            restanteAlDespachar[proceso] = -1;
+        } else {
+            // Recién llegado: empieza desde el vruntime mínimo para no acaparar la CPU
+            vruntime[proceso] = max(vruntime[proceso], minVruntime);
+        }
+        arbol.insert(make_pair(vruntime[proceso], proceso));
+        pesoListos += peso;
+    }
+
+    int siguiente(const Corrida& c) {
+        if (arbol.empty()) return -1;
+        int p = arbol.begin()->second;
+        minVruntime = max(minVruntime, arbol.begin()->first);
+        arbol.erase(arbol.begin());
+        pesoListos -= pesoNice(c.tabla.nice[p]);
+        return p;
+    }
+
+    long long rebanada(int proceso, const Corrida& c) {
+        restanteAlDespachar[proceso] = c.estado.remainingTime[proceso];
+        long long peso = pesoNice(c.tabla.nice[proceso]);
+        long long listos = (long long)arbol.size() + 1;
+        // Con muchos listos el periodo se alarga para respetar la granularidad mínima
+        long long periodo = max(latenciaObjetivo, listos * granularidadMinima);
+        long long cuota = max(granularidadMinima, periodo * peso / (pesoListos + peso));
+        return min(max(cuota, 1LL), c.estado.remainingTime[proceso]);
+    }
+
+private:
+    static const long long ESCALA = 1024;  // Fracciones de unidad del vruntime
+
+    long long latenciaObjetivo;    // Periodo en que cada listo debería correr al menos una vez
+    long long granularidadMinima;  // Rebanada mínima
+    set<pair<long long, int> > arbol;  // (vruntime, ranura) de los listos
+    long long pesoListos;          // Suma de pesos de los listos
+    long long minVruntime;         // Vruntime mínimo visto (no retrocede)
+    vector<long long> vruntime;
+    vector<long long> restanteAlDespachar;  // -1 si la ranura no está en CPU
+};
+
+// Parámetros con los que se crean las políticas por nombre
+struct ParametrosPlanificacion {
+    int quantum;             // Round Robin y quantum del primer nivel de MLFQ (se duplica por nivel)
+    int niveles;             // Niveles de MLFQ
+    long long periodoBoost;  // Periodo del boost de MLFQ (0 = sin boost)
+    long long latenciaObjetivo, granularidadMinima;  // CFS
+};
+
+ParametrosPlanificacion parametrosPorDefecto(int quantum) {
+    ParametrosPlanificacion p = {quantum, 3, 20LL * quantum, 6LL * quantum, max(1, quantum / 2)};
+    return p;
+}
+
+// Crea la política de planificación con ese nombre (fcfs, rr, sjf, srtf, mlfq, cfs), o nullptr
+PoliticaPlanificacion* crearPoliticaPlanificacion(const string& nombre, const ParametrosPlanificacion& p) {
+    if (nombre == "fcfs") return new PoliticaFCFS();
+    if (nombre == "rr") return new PoliticaRoundRobin(p.quantum);
+    if (nombre == "sjf") return new PoliticaSJF();
+    if (nombre == "srtf") return new PoliticaSRTF();
+    if (nombre == "mlfq") {
+        if (p.niveles < 1 || p.niveles > PoliticaMLFQ::MAX_NIVELES) return nullptr;
+        vector<long long> quantums;
+        for (int n = 0; n < p.niveles; ++n) quantums.push_back((long long)p.quantum << min(n, 30));
+        return new PoliticaMLFQ(quantums, p.periodoBoost);
+    }
+    if (nombre == "cfs") {
+        if (p.latenciaObjetivo < 1 || p.granularidadMinima < 1) return nullptr;
+        return new PoliticaCFS(p.latenciaObjetivo, p.granularidadMinima);
+    }
+    return nullptr;
+}
+
+// ---- Utilidades comunes a los planificadores ----
+
+// Ranuras de la tabla global que cumplen el filtro sobre su estado
+template <typename Filtro>
+vector<int> seleccionarRanuras(Filtro incluir) {
+    vector<int> ranuras;
+    const vector<EstadoProceso>& estado = tablaProcesos.dinamico.estado;
+    for (size_t i = 0; i < estado.size(); ++i) {
+        if (incluir(estado[i]))
+            ranuras.push_back((int)i);
+    }
+    return ranuras;
+}
+
+// Ejecuta la política sobre las ranuras indicadas de la tabla global, en su lugar,
+// y devuelve las métricas de la corrida
+MetricasPlanificacion planificarEnTabla(const vector<int>& ranuras, PoliticaPlanificacion& politica, long long inicio) {
+    Corrida c = {tablaProcesos, tablaProcesos.dinamico};
+    SimuladorEventos sim(c, ranuras, politica, inicio);
+    sim.ejecutar();
+    registro.vaciar();
+    return sim.resultados();
+}
+
+// Muestra la tabla de resultados seguida de los percentiles y contadores de la corrida
+void mostrarResultados(const vector<int>& ranuras, const MetricasPlanificacion& metricas) {
+    const TablaProcesos& t = tablaProcesos;
+    bool porProceso = mostrarFilasPorProceso(ranuras.size());  // Si no, solo se muestran promedios
+    if (porProceso) cout << "\nProceso\tLlegada\tEjecución\tFinalización\tRetorno\tEspera\tRespuesta\n";
+    for (size_t i = 0; i < ranuras.size(); ++i) {
+        int r = ranuras[i];
+        long long turnAroundTime = t.dinamico.completionTime[r] - t.arrivalTime[r];
+        long long waitingTime = turnAroundTime - t.burstTime[r];
+        long long responseTime = t.dinamico.firstRunTime[r] - t.arrivalTime[r];
+        if (porProceso)
+            cout << t.nombre(r) << "\t" << t.arrivalTime[r] << "\t" << t.burstTime[r]
+             << "\t\t" << t.dinamico.completionTime[r] << "\t\t" << turnAroundTime
+             << "\t" << waitingTime << "\t" << responseTime << "\n";
+    }
+
+    if (ranuras.empty()) return;
+    mostrarMetricas(metricas);
+}
+
+// Índice de Jain sobre la CPU recibida por unidad de peso: la fracción de su tiempo en el
+// sistema que cada proceso pasó en CPU, dividida por su peso. 1 es un reparto perfecto
+double indiceEquidad(const TablaProcesos& t, const EstadoProcesos& estado, const vector<int>& ranuras) {
+    double suma = 0, sumaCuadrados = 0;
+    for (size_t i = 0; i < ranuras.size(); ++i) {
+        int r = ranuras[i];
+        long long enSistema = estado.completionTime[r] - t.arrivalTime[r];
+        double x = enSistema > 0 ? (double)t.burstTime[r] / enSistema / pesoNice(t.nice[r]) : 0.0;
+        suma += x;
+        sumaCuadrados += x * x;
+    }
+    return sumaCuadrados > 0 ? suma * suma / (ranuras.size() * sumaCuadrados) : 1.0;
+}
+
+// Muestra la cuota de CPU de cada proceso frente a la que le corresponde por su peso
+void mostrarEquidad(const vector<int>& ranuras) {
+    const TablaProcesos& t = tablaProcesos;
+    if (mostrarFilasPorProceso(ranuras.size())) {
+        cout << "\nProceso\tNice\tPeso\tCPU / tiempo en sistema\tCPU por peso (x1024)\n";
+        for (size_t i = 0; i < ranuras.size(); ++i) {
+            int r = ranuras[i];
+            long long enSistema = t.dinamico.completionTime[r] - t.arrivalTime[r];
+            double cuota = enSistema > 0 ? (double)t.burstTime[r] / enSistema : 0.0;
+            cout << t.nombre(r) << "\t" << t.nice[r] << "\t" << pesoNice(t.nice[r]) << "\t"
+                 << 100.0 * cuota << " %\t\t\t" << cuota * PESO_NICE_0 / pesoNice(t.nice[r]) << "\n";
+        }
+    }
+    cout << "Índice de equidad de Jain (CPU por peso): " << indiceEquidad(t, t.dinamico, ranuras) << "\n";
+}
+
+// Filtro de los planificadores: todo proceso que no haya terminado participa
+bool noTerminado(EstadoProceso e) { return e != TERMINADO; }
+
+// Marca como TERMINADOS los procesos planificados (incluidos los suspendidos que participaron)
+void terminarTodos(const vector<int>& ranuras) {
+    for (size_t i = 0; i < ranuras.size(); ++i) {
+        tablaProcesos.dinamico.estado[ranuras[i]] = TERMINADO;
+        tablaProcesos.dinamico.remainingTime[ranuras[i]] = 0;
+    }
+}
+
+// ==== Ejecución de procesos ====
+// Simula la ejecución secuencial (FCFS) de los procesos listos sobre el motor de eventos
+void planificarProcesos() {
+    cout << "\nIniciando planificación (simulada)\n";
+
+    // Cambiar el estado de todos los procesos NUEVOS a LISTOS
+    for (auto& e : tablaProcesos.dinamico.estado) {
+        if (e == NUEVO) e = LISTO;
+    }
+
+    // Solo se ejecutan los procesos LISTOS (los suspendidos se conservan)
+    vector<int> ranuras = seleccionarRanuras([](EstadoProceso e) { return e == LISTO; });
+    PoliticaFCFS fcfs;
+    MetricasPlanificacion metricas = planificarEnTabla(ranuras, fcfs, tiempoGlobal);
+    mostrarResultados(ranuras, metricas);
+}
+
+// ==== Planificación Round Robin ====
+// Simula la planificación de procesos usando el algoritmo Round Robin con quantum fijo
+void ejecutarRoundRobin() {
+    vector<int> ranuras = seleccionarRanuras(noTerminado);
+
+    int quantum = 2;  // Tiempo fijo de CPU por proceso
+    cout << "\nEjecutando Round Robin con quantum = " << quantum << "\n";
+
+    PoliticaRoundRobin rr(quantum);
+    MetricasPlanificacion metricas = planificarEnTabla(ranuras, rr, tiempoGlobal);
+    mostrarResultados(ranuras, metricas);
+    terminarTodos(ranuras);
+}
+
+// ==== Planificación SJF ====
+// Simula la planificación de procesos usando el algoritmo Shortest Job First (sin desalojo)
+void ejecutarSJF() {
+    vector<int> ranuras = seleccionarRanuras(noTerminado);
+
+    cout << "\nEjecutando SJF (Shortest Job First)\n";
+
+    PoliticaSJF sjf;
+    MetricasPlanificacion metricas = planificarEnTabla(ranuras, sjf, 0);
+    mostrarResultados(ranuras, metricas);
+    terminarTodos(ranuras);
+}
+
+// ==== Planificación SRTF ====
+// Simula Shortest Remaining Time First: SJF expropiativo sobre el mismo montículo de listos
+void ejecutarSRTF() {
+    vector<int> ranuras = seleccionarRanuras(noTerminado);
+
+    cout << "\nEjecutando SRTF (Shortest Remaining Time First)\n";
+
+    PoliticaSRTF srtf;
+    MetricasPlanificacion metricas = planificarEnTabla(ranuras, srtf, 0);
+    mostrarResultados(ranuras, metricas);
+    terminarTodos(ranuras);
+}
+
+// ==== Planificación MLFQ ====
+// Pide niveles, quantum base y periodo de boost, y ejecuta la cola multinivel con realimentación
+void ejecutarMLFQ() {
+    ParametrosPlanificacion p = parametrosPorDefecto(2);
+    cout << "Número de niveles (1-" << PoliticaMLFQ::MAX_NIVELES << "): ";
+    cin >> p.niveles;
+    cout << "Quantum del nivel 0 (se duplica en cada nivel): ";
+    cin >> p.quantum;
+    cout << "Periodo del boost de prioridad (0 = sin boost): ";
+    cin >> p.periodoBoost;
+    if (p.quantum < 1 || p.periodoBoost < 0) p.niveles = 0;  // Lo rechaza la fábrica
+    PoliticaPlanificacion* mlfq = crearPoliticaPlanificacion("mlfq", p);
+    if (!mlfq) {
+        cout << "Configuración inválida.\n";
+        return;
+    }
+
+    vector<int> ranuras = seleccionarRanuras(noTerminado);
+    cout << "\nEjecutando MLFQ con " << p.niveles << " niveles, quantum base " << p.quantum << "\n";
+    MetricasPlanificacion metricas = planificarEnTabla(ranuras, *mlfq, tiempoGlobal);
+    mostrarResultados(ranuras, metricas);
+    terminarTodos(ranuras);
+    delete mlfq;
+}
+
+// ==== Planificación CFS ====
+// Reparte la CPU en proporción al peso (nice) de cada proceso
+void ejecutarCFS() {
+    ParametrosPlanificacion p = parametrosPorDefecto(2);
+    cout << "Latencia objetivo y granularidad mínima: ";
+    cin >> p.latenciaObjetivo >> p.granularidadMinima;
+    PoliticaPlanificacion* cfs = crearPoliticaPlanificacion("cfs", p);
+    if (!cfs) {
+        cout << "Configuración inválida.\n";
+        return;
+    }
+
+    vector<int> ranuras = seleccionarRanuras(noTerminado);
+    cout << "\nEjecutando CFS (latencia " << p.latenciaObjetivo << ", granularidad " << p.granularidadMinima << ")\n";
+    MetricasPlanificacion metricas = planificarEnTabla(ranuras, *cfs, tiempoGlobal);
+    mostrarResultados(ranuras, metricas);
+    mostrarEquidad(ranuras);
+    terminarTodos(ranuras);
+    delete cfs;
+}
+
+
+// ==== Planificación multinúcleo ====
+// Simula N núcleos, cada uno con su propia cola de listos (una instancia de la política). Los
+// procesos que llegan van al núcleo menos cargado y, al terminar su rebanada, vuelven a la cola
+// del núcleo donde corrieron. Un núcleo sin trabajo roba un proceso de la cola más larga.
+// Cada despacho cobra el cambio de contexto y, si el proceso viene de otro núcleo, la migración.
+
+struct ConfigMultinucleo {
+    int nucleos;
+    long long cambioContexto;   // Costo de cargar en el núcleo un proceso distinto al anterior
+    long long migracion;        // Costo extra si el proceso corrió antes en otro núcleo
+};
+
+// Con varios núcleos o con costos de cambio/migración se usa el motor multinúcleo, que no desaloja
+bool usaMotorMultinucleo(const ConfigMultinucleo& cfg) {
+    return cfg.nucleos > 1 || cfg.cambioContexto != 0 || cfg.migracion != 0;
+}
+
+struct EstadisticasNucleo {
+    long long ocupado;      // Tiempo ejecutando procesos
+    long long sobrecarga;   // Tiempo gastado en cambios de contexto y migraciones
+    long long despachos;
+    long long robos;        // Procesos tomados de la cola de otro núcleo
+    long long migraciones;  // Despachos de procesos que venían de otro núcleo
+};
+
+/**
+ * Motor de eventos con varios núcleos. Solo admite políticas sin desalojo por llegada
+ * (FCFS, Round Robin, SJF); el quantum de Round Robin sí se respeta.
+ */
+class SimuladorMultinucleo {
+public:
+    SimuladorMultinucleo(const Corrida& corrida, const vector<int>& ranuras, const vector<PoliticaPlanificacion*>& colas,
+                         const ConfigMultinucleo& cfg, long long inicio)
+        : c(corrida), ranuras(ranuras), colas(colas), cfg(cfg), reloj(inicio), secuencia(0),
+          actual(colas.size(), -1), ultimo(colas.size(), -1), rebanadaActual(colas.size(), 0), enCola(colas.size(), 0),
+          ultimoNucleo(corrida.tabla.size(), -1), migracionesProceso(corrida.tabla.size(), 0), pidTraza(-1) {
+        EstadisticasNucleo cero = {0, 0, 0, 0, 0};
+        nucleos.assign(colas.size(), cero);
+    }
+
+    // Ejecuta la simulación hasta vaciar la cola de eventos y devuelve el tiempo final
+    long long ejecutar() {
+        long long inicio = reloj;
+        if (trazaChrome.activa()) {
+            pidTraza = trazaChrome.nuevoProceso("Multinúcleo " + colas[0]->nombre());
+            for (size_t k = 0; k < colas.size(); ++k) trazaChrome.nombrarPista(pidTraza, (int)k, "Núcleo " + to_string(k + 1));
+        }
+        for (size_t i = 0; i < ranuras.size(); ++i)
+            programar(max(reloj, c.tabla.arrivalTime[ranuras[i]]), EVENTO_LLEGADA, ranuras[i], -1);
+
+        while (!eventos.empty()) {
+            reloj = eventos.top().tiempo;
+            for (size_t k = 0; k < colas.size(); ++k) colas[k]->actualizarReloj(reloj);
+            while (!eventos.empty() && eventos.top().tiempo == reloj) {
+                Evento e = eventos.top();
+                eventos.pop();
+                atender(e);
+            }
+
+            for (size_t k = 0; k < colas.size(); ++k) {
+                if (actual[k] == -1)
+                    despachar(k);
+            }
+        }
+        metricas.tiempo = reloj - inicio;
+        metricas.capacidad = metricas.tiempo * (long long)colas.size();
+        return reloj;
+    }
+
+    const vector<EstadisticasNucleo>& estadisticas() const { return nucleos; }
+    const MetricasPlanificacion& resultados() const { return metricas; }
+
+    // Veces que el proceso de esa ranura cambió de núcleo
+    long long migraciones(int proceso) const { return migracionesProceso[proceso]; }
+
+private:
+    void programar(long long tiempo, TipoEvento tipo, int proceso, int nucleo) {
+        Evento e = {tiempo, secuencia++, tipo, proceso, nucleo};
+        eventos.push(e);
+    }
+
+    void encolar(int proceso, size_t nucleo) {
+        c.estado.estado[proceso] = LISTO;
+        colas[nucleo]->agregarListo(proceso, c);
+        ++enCola[nucleo];
+    }
+
+    // Núcleo con menos trabajo: procesos en su cola más el que está ejecutando
+    size_t menosCargado() const {
+        size_t mejor = 0;
+        for (size_t k = 1; k < colas.size(); ++k) {
+            if (enCola[k] + (actual[k] != -1) < enCola[mejor] + (actual[mejor] != -1))
+                mejor = k;
+        }
+        return mejor;
+    }
+
+    void atender(const Evento& e) {
+        if (e.tipo == EVENTO_LLEGADA) {
+            encolar(e.proceso, menosCargado());
+            return;
+        }
+
+        // Fin de la ráfaga en el núcleo del evento
+        int p = e.proceso;
+        size_t k = e.nucleo;
+        c.estado.remainingTime[p] -= rebanadaActual[k];
+        actual[k] = -1;
+        if (c.estado.remainingTime[p] == 0) {
+            c.estado.completionTime[p] = reloj;
+            c.estado.estado[p] = TERMINADO;
+            metricas.registrarFin(c.tabla.arrivalTime[p], c.tabla.burstTime[p], reloj);
+        } else {
+            encolar(p, k);  // Afinidad: vuelve a la cola del núcleo donde corrió
+        }
+    }
+
+    void despachar(size_t k) {
+        int p;
+        if (enCola[k] > 0) {
+            p = colas[k]->siguiente(c);
+            --enCola[k];
+        } else {
+            // Robo de trabajo: se toma un proceso de la cola más larga
+            size_t victima = k;
+            for (size_t v = 0; v < colas.size(); ++v) {
+                if (enCola[v] > enCola[victima]) victima = v;
+            }
+            if (victima == k) return;  // Ningún núcleo tiene procesos esperando
+            p = colas[victima]->robar(c);
+            --enCola[victima];
+            ++nucleos[k].robos;
+            if (registrando(REGISTRO_EVENTOS))
+                registro.anotar(REG_ROBO, (int64_t)k + 1, (int64_t)victima + 1, c.tabla.nombre(p).c_str());
+        }
+
+        long long costo = 0;
+        ++metricas.despachos;
+        if (ultimo[k] != p) {
+            costo += cfg.cambioContexto;
+            ++metricas.cambiosContexto;
+        }
+        if (ultimoNucleo[p] != -1 && ultimoNucleo[p] != (int)k) {
+            costo += cfg.migracion;
+            ++nucleos[k].migraciones;
+            ++migracionesProceso[p];
+        }
+
+        actual[k] = p;
+        ultimo[k] = p;
+        ultimoNucleo[p] = (int)k;
+        c.estado.estado[p] = EJECUTANDO;
+        if (c.estado.firstRunTime[p] < 0) {
+            c.estado.firstRunTime[p] = reloj + costo;
+            metricas.respuesta.registrar(reloj + costo - c.tabla.arrivalTime[p]);
+        }
+        rebanadaActual[k] = colas[k]->rebanada(p, c);
+        nucleos[k].ocupado += rebanadaActual[k];
+        metricas.ocupado += rebanadaActual[k];
+        nucleos[k].sobrecarga += costo;
+        ++nucleos[k].despachos;
+        if (registrando(REGISTRO_EVENTOS))
+            registro.anotar(REG_DESPACHO_NUCLEO, rebanadaActual[k], (int64_t)k + 1, c.tabla.nombre(p).c_str());
+        if (pidTraza >= 0) {
+            // Sin desalojos, la rebanada completa se conoce al despacharla
+            if (costo > 0) trazaChrome.intervalo(pidTraza, (int)k, "Cambio de contexto", "sobrecarga", (double)reloj, (double)costo);
+            trazaChrome.intervalo(pidTraza, (int)k, c.tabla.nombre(p), "cpu", (double)(reloj + costo), (double)rebanadaActual[k]);
+        }
+        pausaVisual();
+        programar(reloj + costo + rebanadaActual[k], EVENTO_FIN_RAFAGA, p, (int)k);
+    }
+
+    Corrida c;
+    const vector<int>& ranuras;
+    const vector<PoliticaPlanificacion*>& colas;  // Cola de listos de cada núcleo
+    ConfigMultinucleo cfg;
+    priority_queue<Evento, vector<Evento>, CompararEventos> eventos;
+    long long reloj;
+    long long secuencia;
+    vector<int> actual;                  // Proceso en cada núcleo (-1 si está libre)
+    vector<int> ultimo;                  // Último proceso que corrió en cada núcleo
+    vector<long long> rebanadaActual;    // Duración de la ráfaga en curso de cada núcleo
+    vector<size_t> enCola;               // Procesos esperando en la cola de cada núcleo
+    vector<int> ultimoNucleo;            // Núcleo donde corrió cada ranura por última vez
+    vector<long long> migracionesProceso;
+    vector<EstadisticasNucleo> nucleos;
+    int pidTraza;                        // Proceso de la línea de tiempo (-1 sin traza)
+    MetricasPlanificacion metricas;
+};
+
+// Muestra la tabla de resultados con las migraciones de cada proceso y el uso de cada núcleo
+void mostrarResultadosMultinucleo(const vector<int>& ranuras, const SimuladorMultinucleo& sim, long long duracion) {
+    const TablaProcesos& t = tablaProcesos;
+    bool porProceso = mostrarFilasPorProceso(ranuras.size());
+    if (porProceso) cout << "\nProceso\tLlegada\tEjecución\tFinalización\tRetorno\tEspera\tMigraciones\n";
+    for (size_t i = 0; i < ranuras.size(); ++i) {
+        int r = ranuras[i];
+        long long turnAroundTime = t.dinamico.completionTime[r] - t.arrivalTime[r];
+        long long waitingTime = turnAroundTime - t.burstTime[r];
+        if (porProceso)
+            cout << t.nombre(r) << "\t" << t.arrivalTime[r] << "\t" << t.burstTime[r]
+                 << "\t\t" << t.dinamico.completionTime[r] << "\t\t" << turnAroundTime
+                 << "\t" << waitingTime << "\t" << sim.migraciones(r) << "\n";
+    }
+    if (ranuras.empty()) return;
+    mostrarMetricas(sim.resultados());
+
+    const vector<EstadisticasNucleo>& nucleos = sim.estadisticas();
+    long long maxOcupado = 0, totalOcupado = 0;
+    cout << "\nNúcleo\tOcupado\tSobrecarga\tUtilización\tDespachos\tRobos\tMigraciones\n";
+    for (size_t k = 0; k < nucleos.size(); ++k) {
+        const EstadisticasNucleo& n = nucleos[k];
+        cout << k + 1 << "\t" << n.ocupado << "\t" << n.sobrecarga << "\t\t"
+             << (duracion > 0 ? 100.0 * n.ocupado / duracion : 0.0) << " %\t\t"
+             << n.despachos << "\t\t" << n.robos << "\t" << n.migraciones << "\n";
+        maxOcupado = max(maxOcupado, n.ocupado);
+        totalOcupado += n.ocupado;
+    }
+    // 1.0 es un reparto perfecto; cuanto más alto, más trabajo recae en el núcleo más cargado
+    double promedio = (double)totalOcupado / nucleos.size();
+    cout << "Desbalance de carga (máximo / promedio): " << (promedio > 0 ? maxOcupado / promedio : 1.0) << "\n";
+}
+
+// Ejecuta RR o SJF sobre N núcleos con los procesos no terminados de la tabla global
+void ejecutarMultinucleo() {
+    ConfigMultinucleo cfg = {2, 0, 0};
+    int opcion, quantum = 2;
+    cout << "Número de núcleos: ";
+    cin >> cfg.nucleos;
+    cout << "Política (1 = Round Robin, 2 = SJF): ";
+    cin >> opcion;
+    if (opcion == 1) {
+        cout << "Quantum: ";
+        cin >> quantum;
+    }
+    cout << "Costo de cambio de contexto y de migración: ";
+    cin >> cfg.cambioContexto >> cfg.migracion;
+    if (cfg.nucleos < 1 || (opcion != 1 && opcion != 2) || quantum < 1 || cfg.cambioContexto < 0 || cfg.migracion < 0) {
+        cout << "Configuración inválida.\n";
+        return;
+    }
+
+    vector<PoliticaPlanificacion*> colas;
+    for (int k = 0; k < cfg.nucleos; ++k)
+        colas.push_back(crearPoliticaPlanificacion(opcion == 1 ? "rr" : "sjf", parametrosPorDefecto(quantum)));
+    cout << "\nEjecutando " << colas[0]->nombre() << " en " << cfg.nucleos << " núcleos\n";
+
+    vector<int> ranuras = seleccionarRanuras(noTerminado);
+    Corrida c = {tablaProcesos, tablaProcesos.dinamico};
+    SimuladorMultinucleo sim(c, ranuras, colas, cfg, tiempoGlobal);
+    long long fin = sim.ejecutar();
+    registro.vaciar();
+    mostrarResultadosMultinucleo(ranuras, sim, fin - tiempoGlobal);
+    terminarTodos(ranuras);
+    for (size_t k = 0; k < colas.size(); ++k) delete colas[k];
+}
+
+
+// ==== Impresión en tiempo virtual ====
+// La misma oficina que el spooler con hilos, pero sobre un reloj virtual en milisegundos y una
+// cola de eventos: un empleado es solo su flujo aleatorio y sus trabajos pendientes, así que
+// cientos de miles de empleados y cientos de impresoras se simulan en milisegundos reales.
+// Los eventos reutilizan los del motor de planificación: una llegada es un documento listo
+// para imprimir y un fin de ráfaga es una impresora que termina (en el campo del núcleo).
+
+struct ResultadoImpresionVirtual {
+    long long trabajos;           // Documentos impresos
+    long long tiempoFinal;        // Milisegundos virtuales hasta el último trabajo
+    HistogramaLog espera;         // Milisegundos en cola por documento
+    double colaPromedio;          // Largo de la cola ponderado por tiempo
+    size_t colaMaxima;
+    vector<long long> ocupada;    // Milisegundos de uso de cada impresora
+    double segundos;              // Tiempo real de la simulación
+};
+
+ResultadoImpresionVirtual simularImpresionVirtual(const ConfigImpresion& cfg) {
+    chrono::steady_clock::time_point inicioReal = chrono::steady_clock::now();
+    vector<FlujoAleatorio> flujos;
+    flujos.reserve(cfg.empleados);
+    vector<int> pendientes(cfg.empleados, cfg.trabajos);
+    priority_queue<Evento, vector<Evento>, CompararEventos> eventos;
+    long long secuencia = 0;
+    for (int e = 0; e < cfg.empleados; ++e) {
+        flujos.push_back(FlujoAleatorio(cfg.semilla, e + 1));
+        if (cfg.trabajos > 0) {
+            Evento listo = {flujos[e].entre(cfg.preparacionMinMs, cfg.preparacionMaxMs), secuencia++, EVENTO_LLEGADA, e, -1};
+            eventos.push(listo);
+        }
+    }
+
+    ResultadoImpresionVirtual r;
+    r.trabajos = 0;
+    r.colaMaxima = 0;
+    r.ocupada.assign(cfg.impresoras, 0);
+    vector<int> libres;
+    for (int i = cfg.impresoras - 1; i >= 0; --i) libres.push_back(i);
+    deque<pair<int, long long> > cola;  // Empleado y momento en que su documento quedó listo
+    vector<long long> ocupadaDesde(cfg.impresoras, 0);
+    long long reloj = 0;
+    double areaCola = 0;  // Integral del largo de la cola en el tiempo
+
+    // Entrega la impresora al documento y programa el fin de la impresión
+    auto imprimir = [&](int empleado, int impresora, long long listo) {
+        r.espera.registrar(reloj - listo);
+        ocupadaDesde[impresora] = reloj;
+        Evento fin = {reloj + flujos[empleado].entre(cfg.trabajoMinMs, cfg.trabajoMaxMs), secuencia++,
+                      EVENTO_FIN_RAFAGA, empleado, impresora};
+        eventos.push(fin);
+    };
+
+    while (!eventos.empty()) {
+        Evento e = eventos.top();
+        eventos.pop();
+        areaCola += (double)cola.size() * (e.tiempo - reloj);
+        reloj = e.tiempo;
+
+        if (e.tipo == EVENTO_LLEGADA) {
+            if (!libres.empty()) {
+                int impresora = libres.back();
+                libres.pop_back();
+                imprimir(e.proceso, impresora, reloj);
+            } else {
+                cola.push_back(make_pair(e.proceso, reloj));
+                r.colaMaxima = max(r.colaMaxima, cola.size());
+            }
+            continue;
+        }
+
+        // Una impresora terminó: el empleado prepara su siguiente documento
+        r.ocupada[e.nucleo] += reloj - ocupadaDesde[e.nucleo];
+        ++r.trabajos;
+        if (--pendientes[e.proceso] > 0) {
+            Evento listo = {reloj + flujos[e.proceso].entre(cfg.preparacionMinMs, cfg.preparacionMaxMs), secuencia++,
+                            EVENTO_LLEGADA, e.proceso, -1};
+            eventos.push(listo);
+        }
+        if (cola.empty()) {
+            libres.push_back(e.nucleo);
+        } else {
+            pair<int, long long> siguiente = cola.front();
+            cola.pop_front();
+            imprimir(siguiente.first, e.nucleo, siguiente.second);
+        }
+    }
+
+    r.tiempoFinal = reloj;
+    r.colaPromedio = reloj > 0 ? areaCola / reloj : 0.0;
+    r.segundos = chrono::duration<double>(chrono::steady_clock::now() - inicioReal).count();
+    return r;
+}
+
+// Utilización promedio de las impresoras durante la simulación
+double utilizacionImpresoras(const ResultadoImpresionVirtual& r) {
+    long long total = 0;
+    for (size_t i = 0; i < r.ocupada.size(); ++i) total += r.ocupada[i];
+    return r.tiempoFinal > 0 && !r.ocupada.empty() ? (double)total / (r.tiempoFinal * (double)r.ocupada.size()) : 0.0;
+}
+
+void mostrarResultadoImpresionVirtual(const ResultadoImpresionVirtual& r) {
+    cout << "\nTrabajos impresos: " << r.trabajos << " en " << r.tiempoFinal << " ms virtuales ("
+         << r.segundos * 1000 << " ms reales)\n";
+    cout << "Espera en cola (ms): promedio " << r.espera.promedio() << ", p50 " << r.espera.percentil(0.50)
+         << ", p99 " << r.espera.percentil(0.99) << ", máxima " << r.espera.mayor() << "\n";
+    cout << "Largo de la cola: promedio " << r.colaPromedio << ", máximo " << r.colaMaxima << "\n";
+    cout << "Utilización promedio de las impresoras: " << 100.0 * utilizacionImpresoras(r) << " %\n";
+    if (r.ocupada.size() <= 16) {
+        for (size_t i = 0; i < r.ocupada.size(); ++i)
+            cout << "Utilización impresora " << i + 1 << ": "
+                 << (r.tiempoFinal > 0 ? 100.0 * r.ocupada[i] / r.tiempoFinal : 0.0) << " %\n";
+    }
+}
+
+// El modo con hilos reales solo tiene sentido con pocos empleados (un hilo y segundos reales cada uno)
+const int MAX_EMPLEADOS_HILOS = 200;
+
+bool configImpresionValida(const ConfigImpresion& cfg) {
+    return cfg.empleados >= 1 && cfg.impresoras >= 1 && cfg.trabajos >= 1 && cfg.preparacionMinMs >= 0 &&
+           cfg.preparacionMaxMs >= cfg.preparacionMinMs && cfg.trabajoMinMs >= 0 && cfg.trabajoMaxMs >= cfg.trabajoMinMs;
+}
+
+// Pide la configuración por consola: demostración con hilos reales (valores por defecto:
+// 5 empleados, 1 impresora) o simulación en tiempo virtual para oficinas grandes
+void menuImpresion() {
+    int modo;
+    ConfigImpresion cfg = {5, 1, 500, 1500, 1000, 3000, 1, (uint64_t)time(nullptr)};
+    std::cout << "Modo (1 = hilos reales, 2 = tiempo virtual): ";
+    std::cin >> modo;
+    std::cout << "Número de empleados: ";
+    std::cin >> cfg.empleados;
+    std::cout << "Número de impresoras: ";
+    std::cin >> cfg.impresoras;
+    if (modo == 2) {
+        std::cout << "Documentos por empleado: ";
+        std::cin >> cfg.trabajos;
+        std::cout << "Preparación mínima y máxima de cada documento (ms): ";
+        std::cin >> cfg.preparacionMinMs >> cfg.preparacionMaxMs;
+    }
+    std::cout << "Duración mínima y máxima de cada trabajo (ms): ";
+    std::cin >> cfg.trabajoMinMs >> cfg.trabajoMaxMs;
+    if (modo == 2) {
+        std::cout << "Semilla: ";
+        std::cin >> cfg.semilla;
+    }
+    if (!configImpresionValida(cfg) || (modo != 1 && modo != 2)) {
+        std::cout << "Configuración inválida.\n";
+        return;
+    }
+    if (modo == 1 && cfg.empleados > MAX_EMPLEADOS_HILOS) {
+        std::cout << "Con hilos reales se admiten hasta " << MAX_EMPLEADOS_HILOS << " empleados; use el tiempo virtual.\n";
+        return;
+    }
+    if (modo == 1) simularImpresion(cfg);
+    else mostrarResultadoImpresionVirtual(simularImpresionVirtual(cfg));
+}
+
+// ==== Trazas de referencias a memoria ====
+// Permite evaluar las políticas de reemplazo sobre trazas reales de millones de referencias.
+// El archivo se mapea en memoria y se recorre en bloques de tamaño fijo, así que la memoria
+// usada depende solo del número de marcos, no del largo de la traza.
+//
+// Formatos aceptados:
+//  - Binario: cabecera "TRZ1" + uint32 con el ancho de cada valor (4 u 8 bytes), seguida de
+//    los números de página en little-endian.
+//  - Texto: números de página decimales o hexadecimales (0x...) separados por espacios,
+//    saltos de línea o comas.
+// La traducción de direcciones usa los mismos formatos, con direcciones virtuales en lugar
+// de números de página.
+
+/**
+ * Archivo de solo lectura mapeado en memoria (MapViewOfFile en Windows, mmap en POSIX).
+ */
+class ArchivoMapeado {
+public:
+    ArchivoMapeado() : datos(nullptr), tam(0) {
+#ifdef _WIN32
+        archivo = INVALID_HANDLE_VALUE;
+        mapeo = nullptr;
+#endif
+    }
+    ~ArchivoMapeado() { cerrar(); }
+
+    bool abrir(const string& ruta) {
+        cerrar();
+#ifdef _WIN32
+        archivo = CreateFileA(ruta.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (archivo == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER tamArchivo;
+        if (!GetFileSizeEx(archivo, &tamArchivo)) { cerrar(); return false; }
+        tam = (size_t)tamArchivo.QuadPart;
+        if (tam == 0) return true;  // Un archivo vacío no se puede mapear, pero es válido
+        mapeo = CreateFileMappingA(archivo, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapeo == nullptr) { cerrar(); return false; }
+        datos = (const char*)MapViewOfFile(mapeo, FILE_MAP_READ, 0, 0, 0);
+        if (datos == nullptr) { cerrar(); return false; }
+#else
+        int fd = open(ruta.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat info;
+        if (fstat(fd, &info) != 0) { close(fd); return false; }
+        tam = (size_t)info.st_size;
+        if (tam > 0) {
+            void* p = mmap(nullptr, tam, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) { close(fd); tam = 0; return false; }
+            madvise(p, tam, MADV_SEQUENTIAL);  // Lectura secuencial: el kernel puede leer por adelantado
+            datos = (const char*)p;
+        }
+        close(fd);  // El mapeo sigue vigente sin el descriptor
+#endif
+        return true;
+    }
+
+    void cerrar() {
+#ifdef _WIN32
+        if (datos) UnmapViewOfFile(datos);
+        if (mapeo) CloseHandle(mapeo);
+        if (archivo != INVALID_HANDLE_VALUE) CloseHandle(archivo);
+        mapeo = nullptr;
+        archivo = INVALID_HANDLE_VALUE;
+#else
+        if (datos) munmap((void*)datos, tam);
+#endif
+        datos = nullptr;
+        tam = 0;
+    }
+
+    const char* datos;  // Contenido del archivo
+    size_t tam;         // Tamaño en bytes
+
+private:
+    ArchivoMapeado(const ArchivoMapeado&);             // No copiable
+    ArchivoMapeado& operator=(const ArchivoMapeado&);
+#ifdef _WIN32
+    HANDLE archivo;
+    HANDLE mapeo;
+#endif
+};
+
+/**
+ * Lector de trazas por bloques sobre un archivo mapeado.
+ * Detecta el formato binario por su cabecera; cualquier otro archivo se interpreta como texto.
+ * En texto los valores se separan solo con espacios en blanco o comas; cualquier otro carácter,
+ * un valor mal formado (p. ej. "abc", "12abc", "-5", "1.5" o "0x" solo) o uno que no cabe en
+ * 64 bits invalida la traza: la lectura se detiene, se informa la posición y malformada() queda
+ * en true. Un archivo binario cuyo contenido no es múltiplo del ancho también es inválido.
+ */
+class LectorTraza {
+public:
+    LectorTraza() : pos(0), binario(false), ancho(0), invalida(false) {}
+
+    bool abrir(const string& ruta) {
+        pos = 0;
+        binario = false;
+        invalida = false;
+        if (!archivo.abrir(ruta)) return false;
+        if (archivo.tam >= 8 && memcmp(archivo.datos, "TRZ1", 4) == 0) {
+            uint32_t w;
+            memcpy(&w, archivo.datos + 4, sizeof(w));
+            if (w != 4 && w != 8) return false;
+            binario = true;
+            ancho = w;
+            pos = 8;
+            if ((archivo.tam - pos) % ancho != 0) {
+                cerr << "Traza inválida: el contenido binario (" << archivo.tam - pos
+                     << " bytes) no es múltiplo de " << ancho << " bytes.\n";
+                invalida = true;
+            }
+        }
+        return true;
+    }
+
+    bool esBinario() const { return binario; }
+    bool malformada() const { return invalida; }
+
+    // Llena 'bloque' con hasta 'maximo' referencias; devuelve cuántas leyó (0 al final)
+    size_t leerBloque(vector<uint64_t>& bloque, size_t maximo) {
+        bloque.clear();
+        if (invalida) return 0;
+        if (binario) {
+            size_t disponibles = (archivo.tam - pos) / ancho;
+            size_t n = min(maximo, disponibles);
+            bloque.resize(n);
+            for (size_t i = 0; i < n; ++i, pos += ancho) {
+                if (ancho == 4) {
+                    uint32_t v;
+                    memcpy(&v, archivo.datos + pos, 4);
+                    bloque[i] = v;
+                } else {
+                    memcpy(&bloque[i], archivo.datos + pos, 8);
+                }
+            }
+            return n;
+        }
+
+        const char* d = archivo.datos;
+        size_t tam = archivo.tam;
+        while (bloque.size() < maximo) {
+            while (pos < tam && esSeparador(d[pos])) ++pos;
+            if (pos >= tam) break;
+
+            size_t inicio = pos;
+            uint64_t valor = 0;
+            bool digitos = false, desborde = false;
+            if (d[pos] == '0' && pos + 1 < tam && (d[pos + 1] == 'x' || d[pos + 1] == 'X')) {
+                pos += 2;
+                while (pos < tam && isxdigit((unsigned char)d[pos])) {
+                    char ch = d[pos++];
+                    if (valor > (UINT64_MAX >> 4)) desborde = true;
+                    valor = valor * 16 + (isdigit((unsigned char)ch) ? ch - '0' : (tolower(ch) - 'a' + 10));
+                    digitos = true;
+                }
+            } else {
+                while (pos < tam && isdigit((unsigned char)d[pos])) {
+                    uint64_t digito = (uint64_t)(d[pos++] - '0');
+                    if (valor > (UINT64_MAX - digito) / 10) desborde = true;
+                    valor = valor * 10 + digito;
+                    digitos = true;
+                }
+            }
+            // El token debe terminar justo después de sus dígitos, en un separador o al final
+            if (!digitos || desborde || (pos < tam && !esSeparador(d[pos]))) {
+                rechazar(inicio);
+                bloque.clear();
+                return 0;
+            }
+            bloque.push_back(valor);
+        }
+        return bloque.size();
+    }
+
+private:
+    static bool esSeparador(char c) { return c == ',' || isspace((unsigned char)c); }
+
+    // Marca la traza como inválida e informa la línea y columna del token que empieza en 'inicio'
+    void rechazar(size_t inicio) {
+        const char* d = archivo.datos;
+        size_t fin = inicio;
+        while (fin < archivo.tam && !esSeparador(d[fin])) ++fin;
+        size_t linea = 1 + count(d, d + inicio, '\n');
+        size_t columna = inicio + 1;
+        for (size_t i = inicio; i > 0; --i) {
+            if (d[i - 1] == '\n') {
+                columna = inicio - i + 1;
+                break;
+            }
+        }
+        cerr << "Traza inválida: valor \"" << string(d + inicio, fin - inicio) << "\" en la línea "
+             << linea << ", columna " << columna << ".\n";
+        invalida = true;
+        pos = archivo.tam;
+    }
+
+    ArchivoMapeado archivo;
+    size_t pos;       // Posición de lectura dentro del archivo
+    bool binario;
+    uint32_t ancho;   // Bytes por referencia en formato binario
+    bool invalida;    // Se encontró un valor mal formado en la traza de texto
+};
+
+// ==== Instantáneas de la tabla de procesos ====
+// Guarda la tabla de procesos y el reloj del sistema en un archivo binario versionado y los
+// restaura idénticos, así las comparaciones de antes y después usan exactamente la misma
+// entrada. Al cargar, el archivo se mapea y cada columna se copia de un solo bloque, por lo
+// que millones de procesos se restauran en milisegundos en lugar de regenerarse.
+
+/**
+ * Cabecera de la instantánea (64 bytes). Todo se escribe en el orden de bytes del equipo;
+ * ordenBytes permite rechazar un archivo escrito en otra arquitectura. Le siguen las columnas
+ * de la tabla, cada una alineada a 8 bytes: llegada, ráfaga, tiempo restante, fin y primer despacho
+ * (int64), nice (int32), estado (uint8), largo de cada id (uint32, SIN_ID_INSTANTANEA en las
+ * ranuras anónimas) y los bytes de todos los ids seguidos.
+ */
+struct CabeceraInstantanea {
+    char magico[4];         // "TPR1"
+    uint32_t version;
+    uint64_t procesos;
+    int64_t tiempoGlobal;   // Reloj del sistema al guardar
+    uint64_t bytesIds;      // Suma de los largos de los ids
+    uint64_t ordenBytes;    // MARCA_ORDEN_INSTANTANEA tal como la ve el equipo que escribió
+    uint64_t reservado[3];
+};
+static_assert(sizeof(CabeceraInstantanea) == 64, "formato de instantánea inesperado");
+
+const char MAGICO_INSTANTANEA[4] = {'T', 'P', 'R', '1'};
+const uint32_t VERSION_INSTANTANEA = 2;
+const uint64_t MARCA_ORDEN_INSTANTANEA = 0x0102030405060708ULL;
+const uint32_t SIN_ID_INSTANTANEA = 0xFFFFFFFFu;
+
+inline uint64_t alinear8(uint64_t n) { return (n + 7) & ~(uint64_t)7; }
+
+// Escribe los bytes de una columna y completa con ceros hasta múltiplo de 8
+void escribirColumna(ofstream& out, const void* datos, uint64_t bytes) {
+    static const char ceros[8] = {0};
+    if (bytes) out.write((const char*)datos, (streamsize)bytes);
+    out.write(ceros, (streamsize)(alinear8(bytes) - bytes));
+}
+
+bool guardarInstantanea(const string& ruta, const TablaProcesos& tabla, long long reloj) {
+    ofstream out(ruta.c_str(), ios::binary);
+    if (!out) return false;
+
+    size_t n = tabla.size();
+    vector<uint8_t> estados(n);
+    vector<uint32_t> largos(n);
+    CabeceraInstantanea c;
+    memset(&c, 0, sizeof(c));
+    memcpy(c.magico, MAGICO_INSTANTANEA, sizeof(c.magico));
+    c.version = VERSION_INSTANTANEA;
+    c.procesos = n;
+    c.tiempoGlobal = reloj;
+    c.ordenBytes = MARCA_ORDEN_INSTANTANEA;
+    for (size_t i = 0; i < n; ++i) {
+        estados[i] = (uint8_t)tabla.dinamico.estado[i];
+        largos[i] = tabla.id[i] ? (uint32_t)tabla.id[i]->size() : SIN_ID_INSTANTANEA;
+        if (tabla.id[i]) c.bytesIds += largos[i];
+    }
+
+    out.write((const char*)&c, sizeof(c));
+    escribirColumna(out, tabla.arrivalTime.data(), n * sizeof(long long));
+    escribirColumna(out, tabla.burstTime.data(), n * sizeof(long long));
+    escribirColumna(out, tabla.dinamico.remainingTime.data(), n * sizeof(long long));
+    escribirColumna(out, tabla.dinamico.completionTime.data(), n * sizeof(long long));
+    escribirColumna(out, tabla.dinamico.firstRunTime.data(), n * sizeof(long long));
+    escribirColumna(out, tabla.nice.data(), n * sizeof(int));
+    escribirColumna(out, estados.data(), n);
+    escribirColumna(out, largos.data(), n * sizeof(uint32_t));
+    string ids;
+    ids.reserve(c.bytesIds);
+    for (size_t i = 0; i < n; ++i) {
+        if (tabla.id[i]) ids += *tabla.id[i];
+    }
+    escribirColumna(out, ids.data(), ids.size());
+    out.close();  // Los errores al vaciar el búfer solo aparecen al cerrar
+    return !out.fail();
+}
+
+// Copia una columna desde el archivo mapeado y avanza al inicio de la siguiente
+template <typename T>
+void leerColumna(const char*& p, vector<T>& destino, size_t n) {
+    destino.resize(n);
+    if (n) memcpy(destino.data(), p, n * sizeof(T));
+    p += alinear8(n * sizeof(T));
+}
+
+/**
+ * Restaura la tabla y el reloj. Todo el archivo se valida antes de tocar la tabla, así que si
+ * la instantánea está dañada o es de otra versión, la tabla queda como estaba.
+ */
+bool cargarInstantanea(const string& ruta, TablaProcesos& tabla, long long& reloj) {
+    ArchivoMapeado archivo;
+    if (!archivo.abrir(ruta) || archivo.tam < sizeof(CabeceraInstantanea)) return false;
+    CabeceraInstantanea c;
+    memcpy(&c, archivo.datos, sizeof(c));
+    if (memcmp(c.magico, MAGICO_INSTANTANEA, sizeof(c.magico)) != 0 || c.version != VERSION_INSTANTANEA ||
+        c.ordenBytes != MARCA_ORDEN_INSTANTANEA)
+        return false;
+    // El reloj del sistema es un int: un valor fuera de rango no se puede restaurar sin truncarlo
+    if (c.tiempoGlobal < 0 || c.tiempoGlobal > INT_MAX) return false;
+
+    // Cada proceso ocupa al menos 49 bytes; así se descarta un conteo absurdo antes de multiplicar
+    uint64_t n = c.procesos;
+    if (n > archivo.tam / 49 || c.bytesIds > archivo.tam) return false;
+    uint64_t esperado = sizeof(c) + 5 * alinear8(n * sizeof(long long)) + alinear8(n * sizeof(int)) + alinear8(n) +
+                        alinear8(n * sizeof(uint32_t)) + alinear8(c.bytesIds);
+    if (archivo.tam != esperado) return false;
+
+    const char* p = archivo.datos + sizeof(c);
+    vector<long long> llegada, rafaga, restante, fin, primerDespacho;
+    vector<int> nice;
+    vector<uint8_t> estados;
+    vector<uint32_t> largos;
+    leerColumna(p, llegada, n);
+    leerColumna(p, rafaga, n);
+    leerColumna(p, restante, n);
+    leerColumna(p, fin, n);
+    leerColumna(p, primerDespacho, n);
+    leerColumna(p, nice, n);
+    leerColumna(p, estados, n);
+    leerColumna(p, largos, n);
+    uint64_t bytesIds = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (estados[i] > TERMINADO || nice[i] < NICE_MIN || nice[i] > NICE_MAX) return false;
+        if (largos[i] != SIN_ID_INSTANTANEA) bytesIds += largos[i];
+    }
+    if (bytesIds != c.bytesIds) return false;
+    const char* ids = p;
+    for (size_t i = 0; i < n; ++i) {
+        if (largos[i] == SIN_ID_INSTANTANEA) continue;
+        if (!TablaProcesos::idValido(string(ids, largos[i]))) return false;
+        ids += largos[i];
+    }
+
+    tabla.vaciar();
+    tabla.arrivalTime.swap(llegada);
+    tabla.burstTime.swap(rafaga);
+    tabla.nice.swap(nice);
+    tabla.dinamico.remainingTime.swap(restante);
+    tabla.dinamico.completionTime.swap(fin);
+    tabla.dinamico.firstRunTime.swap(primerDespacho);
+    tabla.dinamico.estado.resize(n);
+    tabla.id.assign(n, nullptr);
+    for (size_t i = 0; i < n; ++i) {
+        tabla.dinamico.estado[i] = (EstadoProceso)estados[i];
+        if (largos[i] == SIN_ID_INSTANTANEA) continue;
+        tabla.nombrar((int)i, string(p, largos[i]));
+        p += largos[i];
+    }
+    reloj = c.tiempoGlobal;
+    return true;
+}
+
+// Guarda la tabla global de procesos
+void menuGuardarInstantanea() {
+    string ruta;
+    cout << "Ruta de la instantánea: ";
+    cin >> ruta;
+    if (!guardarInstantanea(ruta, tablaProcesos, tiempoGlobal)) {
+        cout << "No se pudo escribir " << ruta << ".\n";
+        return;
+    }
+    cout << tablaProcesos.size() << " procesos guardados en " << ruta << ".\n";
+}
+
+// Reemplaza la tabla global de procesos por la de una instantánea
+void menuCargarInstantanea() {
+    string ruta;
+    cout << "Ruta de la instantánea: ";
+    cin >> ruta;
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    long long reloj;
+    if (!cargarInstantanea(ruta, tablaProcesos, reloj)) {
+        cout << "No se pudo cargar la instantánea " << ruta << " (archivo dañado o de otra versión).\n";
+        return;
+    }
+    tiempoGlobal = (int)reloj;
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+    cout << tablaProcesos.size() << " procesos restaurados en " << ms << " ms.\n";
+}
+
+// ==== Políticas de reemplazo de páginas ====
+
+/**
+ * Base de los motores de reemplazo de páginas: lleva la cuenta de referencias, fallos y
+ * reemplazos para todas las políticas. Cada motor solo decide si la página está residente
+ * y, si hace falta, qué página desalojar (que informa con desalojar()).
+ */
+class PoliticaReemplazo {
+public:
+    explicit PoliticaReemplazo(size_t marcos)
+        : marcos(marcos), referencias(0), fallos(0), reemplazos(0), huboReemplazo(false), victima(0) {}
+    virtual ~PoliticaReemplazo() {}
+
+    virtual string nombre() const = 0;
+
+    // Páginas residentes, en el orden natural de la política (para mostrar el estado)
+    virtual vector<uint64_t> residentes() const = 0;
+
+    // Procesa una referencia; devuelve true si produjo un fallo de página
+    bool referenciar(uint64_t pagina) {
+        ++referencias;
+        huboReemplazo = false;
+        if (!acceder(pagina)) return false;
+        ++fallos;
+        return true;
+    }
+
+    size_t marcos;                    // Número de marcos físicos
+    unsigned long long referencias;   // Referencias procesadas
+    unsigned long long fallos;        // Fallos de página
+    unsigned long long reemplazos;    // Fallos que desalojaron otra página
+    bool huboReemplazo;               // La última referencia desalojó una página
+    uint64_t victima;                 // Página desalojada en la última referencia
+
+protected:
+    // Devuelve true si la página no estaba residente (y la carga)
+    virtual bool acceder(uint64_t pagina) = 0;
+
+    // Registra que 'pagina' salió de memoria
+    void desalojar(uint64_t pagina) {
+        ++reemplazos;
+        huboReemplazo = true;
+        victima = pagina;
+    }
+};
+
+// FIFO: los marcos forman un anillo y la víctima es siempre la página cargada hace más tiempo
+class MotorFIFO : public PoliticaReemplazo {
+public:
+    explicit MotorFIFO(size_t marcos) : PoliticaReemplazo(marcos), anillo(marcos), usados(0), masAntigua(0) {
+        residentesSet.reserve(marcos * 2);
+    }
+    string nombre() const { return "FIFO"; }
+
+    vector<uint64_t> residentes() const {
+        vector<uint64_t> r;
+        for (size_t i = 0; i < usados; ++i)
+            r.push_back(anillo[(masAntigua + i) % usados]);
+        return r;
+    }
+
+protected:
+    bool acceder(uint64_t pagina) {
+        if (residentesSet.count(pagina)) return false;
+        if (usados < marcos) {
+            anillo[usados++] = pagina;
+        } else {
+            desalojar(anillo[masAntigua]);
+            residentesSet.erase(anillo[masAntigua]);
+            anillo[masAntigua] = pagina;
+            masAntigua = (masAntigua + 1) % marcos;
+        }
+        residentesSet.insert(pagina);
+        return true;
+    }
+
+private:
+    vector<uint64_t> anillo;               // Página cargada en cada marco
+    unordered_set<uint64_t> residentesSet; // Páginas en memoria
+    size_t usados;                          // Marcos ocupados
+    size_t masAntigua;                      // Marco con la página más antigua
+};
+
+// LRU: lista doblemente enlazada sobre los marcos (índices, sin nodos en el heap)
+class MotorLRU : public PoliticaReemplazo {
+public:
+    explicit MotorLRU(size_t marcos)
+        : PoliticaReemplazo(marcos), pagina(marcos), ant(marcos), sig(marcos), reciente(-1), antigua(-1), usados(0) {
+        marcoDe.reserve(marcos * 2);
+    }
+    string nombre() const { return "LRU"; }
+
+    // De la más reciente a la menos recientemente usada
+    vector<uint64_t> residentes() const {
+        vector<uint64_t> r;
+        for (int m = reciente; m != -1; m = sig[m]) r.push_back(pagina[m]);
+        return r;
+    }
+
+protected:
+    bool acceder(uint64_t p) {
+        unordered_map<uint64_t, int>::iterator it = marcoDe.find(p);
+        if (it != marcoDe.end()) {
+            desenlazar(it->second);
+            alFrente(it->second);
+            return false;
+        }
+
+        int m;
+        if (usados < marcos) {
+            m = (int)usados++;
+        } else {
+            m = antigua;  // Página menos recientemente usada
+            desenlazar(m);
+            desalojar(pagina[m]);
+            marcoDe.erase(pagina[m]);
+        }
+        pagina[m] = p;
+        marcoDe[p] = m;
+        alFrente(m);
+        return true;
+    }
+
+private:
+    void desenlazar(int m) {
+        if (ant[m] != -1) sig[ant[m]] = sig[m]; else reciente = sig[m];
+        if (sig[m] != -1) ant[sig[m]] = ant[m]; else antigua = ant[m];
+    }
+
+    void alFrente(int m) {
+        ant[m] = -1;
+        sig[m] = reciente;
+        if (reciente != -1) ant[reciente] = m;
+        reciente = m;
+        if (antigua == -1) antigua = m;
+    }
+
+    vector<uint64_t> pagina;              // Página cargada en cada marco
+    vector<int> ant, sig;                 // Enlaces de la lista de recencia
+    int reciente, antigua;                // Extremos de la lista
+    size_t usados;                        // Marcos ocupados
+    unordered_map<uint64_t, int> marcoDe; // Página -> marco
+};
+
+// CLOCK: los marcos forman un reloj con bit de referencia; la manecilla limpia bits
+// hasta encontrar una página sin referencia reciente
+class MotorCLOCK : public PoliticaReemplazo {
+public:
+    explicit MotorCLOCK(size_t marcos)
+        : PoliticaReemplazo(marcos), pagina(marcos), referenciada(marcos, false), usados(0), manecilla(0) {
+        marcoDe.reserve(marcos * 2);
+    }
+    string nombre() const { return "CLOCK"; }
+
+    vector<uint64_t> residentes() const { return vector<uint64_t>(pagina.begin(), pagina.begin() + usados); }
+
+protected:
+    bool acceder(uint64_t p) {
+        unordered_map<uint64_t, size_t>::iterator it = marcoDe.find(p);
+        if (it != marcoDe.end()) {
+            referenciada[it->second] = true;
+            return false;
+        }
+
+        size_t m;
+        if (usados < marcos) {
+            m = usados++;
+        } else {
+            while (referenciada[manecilla]) {
+                referenciada[manecilla] = false;
+                manecilla = (manecilla + 1) % marcos;
+            }
+            m = manecilla;
+            manecilla = (manecilla + 1) % marcos;
+            desalojar(pagina[m]);
+            marcoDe.erase(pagina[m]);
+        }
+        pagina[m] = p;
+        referenciada[m] = true;
+        marcoDe[p] = m;
+        return true;
+    }
+
+private:
+    vector<uint64_t> pagina;                 // Página de cada marco
+    vector<bool> referenciada;               // Bit de referencia de cada marco
+    size_t usados;
+    size_t manecilla;                        // Próximo marco candidato
+    unordered_map<uint64_t, size_t> marcoDe; // Página -> marco
+};
+
+// Segunda oportunidad: cola FIFO donde una página referenciada pierde su bit y vuelve al final
+class MotorSegundaOportunidad : public PoliticaReemplazo {
+public:
+    explicit MotorSegundaOportunidad(size_t marcos) : PoliticaReemplazo(marcos) { bit.reserve(marcos * 2); }
+    string nombre() const { return "2da Oport."; }
+
+    vector<uint64_t> residentes() const { return vector<uint64_t>(cola.begin(), cola.end()); }
+
+protected:
+    bool acceder(uint64_t p) {
+        unordered_map<uint64_t, bool>::iterator it = bit.find(p);
+        if (it != bit.end()) {
+            it->second = true;
+            return false;
+        }
+
+        if (cola.size() == marcos) {
+            // Las páginas referenciadas reciben una segunda oportunidad al final de la cola
+            while (bit[cola.front()]) {
+                bit[cola.front()] = false;
+                cola.push_back(cola.front());
+                cola.pop_front();
+            }
+            desalojar(cola.front());
+            bit.erase(cola.front());
+            cola.pop_front();
+        }
+        cola.push_back(p);
+        bit[p] = true;  // Como en CLOCK, la carga cuenta como referencia
+        return true;
+    }
+
+private:
+    deque<uint64_t> cola;                // Orden de carga (o de última segunda oportunidad)
+    unordered_map<uint64_t, bool> bit;   // Página residente -> bit de referencia
+};
+
+/**
+ * ARC (Adaptive Replacement Cache, Megiddo y Modha): T1 guarda páginas vistas una vez y T2
+ * las vistas varias veces; B1 y B2 recuerdan páginas desalojadas de cada una (fantasmas)
+ * y ajustan el tamaño objetivo p de T1 según dónde se producen los aciertos fantasma.
+ */
+class MotorARC : public PoliticaReemplazo {
+public:
+    explicit MotorARC(size_t marcos) : PoliticaReemplazo(marcos), p(0) { donde.reserve(marcos * 4); }
+    string nombre() const { return "ARC"; }
+
+    vector<uint64_t> residentes() const {
+        vector<uint64_t> r(listas[T1].begin(), listas[T1].end());
+        r.insert(r.end(), listas[T2].begin(), listas[T2].end());
+        return r;
+    }
+
+protected:
+    bool acceder(uint64_t x) {
+        unordered_map<uint64_t, Ubicacion>::iterator it = donde.find(x);
+        size_t c = marcos;
+
+        if (it != donde.end() && (it->second.lista == T1 || it->second.lista == T2)) {
+            mover(x, T2);  // Acierto: pasa a ser frecuente
+            return false;
+        }
+
+        if (it != donde.end() && it->second.lista == B1) {
+            size_t delta = max<size_t>(1, listas[B2].size() / listas[B1].size());
+            p = min(c, p + delta);
+            reemplazar(false);
+            mover(x, T2);
+            return true;
+        }
+
+        if (it != donde.end() && it->second.lista == B2) {
+            size_t delta = max<size_t>(1, listas[B1].size() / listas[B2].size());
+            p = p > delta ? p - delta : 0;
+            reemplazar(true);
+            mover(x, T2);
+            return true;
+        }
+
+        // Página nueva
+        size_t l1 = listas[T1].size() + listas[B1].size();
+        size_t total = l1 + listas[T2].size() + listas[B2].size();
+        if (l1 == c) {
+            if (listas[T1].size() < c) {
+                olvidar(B1);
+                reemplazar(false);
+            } else {
+                desalojar(listas[T1].back());  // B1 vacío: se descarta directamente de T1
+                olvidar(T1);
+            }
+        } else if (total >= c) {
+            if (total == 2 * c) olvidar(B2);
+            reemplazar(false);
+        }
+        listas[T1].push_front(x);
+        donde[x] = Ubicacion(T1, listas[T1].begin());
+        return true;
+    }
+
+private:
+    enum { T1, T2, B1, B2 };
+
+    struct Ubicacion {
+        Ubicacion() : lista(0) {}
+        Ubicacion(int l, list<uint64_t>::iterator i) : lista(l), it(i) {}
+        int lista;
+        list<uint64_t>::iterator it;
+    };
+
+    // Pasa x (presente en alguna lista) al frente (MRU) de la lista destino
+    void mover(uint64_t x, int destino) {
+        Ubicacion& u = donde[x];
+        listas[destino].splice(listas[destino].begin(), listas[u.lista], u.it);
+        u.lista = destino;
+        u.it = listas[destino].begin();
+    }
+
+    // Elimina por completo la página LRU de la lista indicada
+    void olvidar(int lista) {
+        donde.erase(listas[lista].back());
+        listas[lista].pop_back();
+    }
+
+    // Desaloja la LRU de T1 o de T2 hacia su lista fantasma, según el objetivo p
+    void reemplazar(bool enB2) {
+        size_t t1 = listas[T1].size();
+        if (t1 >= 1 && ((enB2 && t1 == p) || t1 > p)) {
+            desalojar(listas[T1].back());
+            mover(listas[T1].back(), B1);
+        } else if (!listas[T2].empty()) {
+            desalojar(listas[T2].back());
+            mover(listas[T2].back(), B2);
+        }
+    }
+
+    list<uint64_t> listas[4];                     // T1, T2, B1, B2 (frente = más reciente)
+    unordered_map<uint64_t, Ubicacion> donde;     // Página -> lista y posición
+    size_t p;                                     // Tamaño objetivo de T1
+};
+
+/**
+ * OPT de Belady: desaloja la página cuyo próximo uso está más lejos en el futuro.
+ * Necesita la traza completa: un recorrido hacia atrás calcula el próximo uso de cada
+ * referencia, y las residentes se ordenan por próximo uso en un árbol, así que cada
+ * referencia cuesta O(log F) en lugar de buscar hacia adelante en la traza.
+ */
+class MotorOPT : public PoliticaReemplazo {
+public:
+    MotorOPT(size_t marcos, const vector<uint64_t>& traza)
+        : PoliticaReemplazo(marcos), proximoUso(traza.size()), cursor(0) {
+        const size_t NUNCA = traza.size();
+        unordered_map<uint64_t, size_t> siguiente;
+        for (size_t i = traza.size(); i-- > 0;) {
+            unordered_map<uint64_t, size_t>::iterator it = siguiente.find(traza[i]);
+            proximoUso[i] = it == siguiente.end() ? NUNCA : it->second;
+            siguiente[traza[i]] = i;
+        }
+        usoDe.reserve(marcos * 2);
+    }
+    string nombre() const { return "OPT"; }
+
+    vector<uint64_t> residentes() const {
+        vector<uint64_t> r;
+        for (unordered_map<uint64_t, size_t>::const_iterator it = usoDe.begin(); it != usoDe.end(); ++it)
+            r.push_back(it->first);
+        sort(r.begin(), r.end());
+        return r;
+    }
+
+protected:
+    // Debe recibir las referencias en el mismo orden de la traza usada al construirlo
+    bool acceder(uint64_t p) {
+        size_t proximo = cursor < proximoUso.size() ? proximoUso[cursor] : proximoUso.size();
+        ++cursor;
+
+        unordered_map<uint64_t, size_t>::iterator it = usoDe.find(p);
+        if (it != usoDe.end()) {
+            porUso.erase(make_pair(it->second, p));
+            porUso.insert(make_pair(proximo, p));
+            it->second = proximo;
+            return false;
+        }
+
+        if (usoDe.size() == marcos) {
+            set<pair<size_t, uint64_t> >::iterator lejana = --porUso.end();
+            desalojar(lejana->second);
+            usoDe.erase(lejana->second);
+            porUso.erase(lejana);
+        }
+        porUso.insert(make_pair(proximo, p));
+        usoDe[p] = proximo;
+        return true;
+    }
+
+private:
+    vector<size_t> proximoUso;                // Índice del próximo uso de cada referencia
+    size_t cursor;                            // Referencia actual dentro de la traza
+    set<pair<size_t, uint64_t> > porUso;      // Residentes ordenadas por próximo uso
+    unordered_map<uint64_t, size_t> usoDe;    // Residente -> próximo uso
+};
+
+// Políticas que pueden procesar una traza en flujo (OPT se trata aparte: necesita la traza completa)
+const char* const POLITICAS_FLUJO[] = {"FIFO", "LRU", "CLOCK", "2da Oport.", "ARC"};
+const size_t NUM_POLITICAS_FLUJO = sizeof(POLITICAS_FLUJO) / sizeof(POLITICAS_FLUJO[0]);
+
+// Crea el motor de flujo con ese nombre, o nullptr si no existe
+PoliticaReemplazo* crearMotorReemplazo(const string& nombre, size_t marcos) {
+    if (nombre == "FIFO") return new MotorFIFO(marcos);
+    if (nombre == "LRU") return new MotorLRU(marcos);
+    if (nombre == "CLOCK") return new MotorCLOCK(marcos);
+    if (nombre == "2da Oport.") return new MotorSegundaOportunidad(marcos);
+    if (nombre == "ARC") return new MotorARC(marcos);
+    return nullptr;
+}
+
+// ==== Memoria: simulación paso a paso ====
+
+// Secuencia de referencias de ejemplo y marcos usados en las demostraciones del menú
+const uint64_t REFERENCIAS_EJEMPLO[] = {7, 0, 1, 2, 0, 3, 0, 4, 2, 3, 0, 3, 2};
+const size_t MARCOS_EJEMPLO = 4;
+
+vector<uint64_t> referenciasEjemplo() {
+    return vector<uint64_t>(REFERENCIAS_EJEMPLO, REFERENCIAS_EJEMPLO + sizeof(REFERENCIAS_EJEMPLO) / sizeof(uint64_t));
+}
+
+// Ejecuta cualquier política sobre la secuencia, mostrando el estado de memoria en cada paso
+void simularReemplazoPasoAPaso(PoliticaReemplazo& motor, const vector<uint64_t>& referencias) {
+    cout << "\nSimulación " << motor.nombre() << " con " << motor.marcos << " marcos\n";
+    for (size_t i = 0; i < referencias.size(); ++i) {
+        uint64_t page = referencias[i];
+        if (motor.referenciar(page)) {
+            if (motor.huboReemplazo)
+                cout << "\n Página " << motor.victima << " reemplazada por " << page << ".";
+            else
+                cout << "\n Página " << page << " cargada en un marco vacío.";
+        } else {
+            cout << "\n Página " << page << " ya en memoria.";
+        }
+
+        cout << "\n Memoria: ";
+        vector<uint64_t> memoria = motor.residentes();
+        for (size_t j = 0; j < memoria.size(); ++j) cout << memoria[j] << " ";
+        cout << "| Fallos: " << motor.fallos << "\n";
+    }
+
+    // Mostrar el total de fallos de página al final del proceso
+    cout << "\n Total de fallos de página: " << motor.fallos << endl;
+}
+
+// ==== Memoria FIFO ====
+void simularFIFO() {
+    MotorFIFO motor(MARCOS_EJEMPLO);
+    simularReemplazoPasoAPaso(motor, referenciasEjemplo());
+}
+
+// ==== Memoria LRU ====
+void simularLRU() {
+    MotorLRU motor(MARCOS_EJEMPLO);
+    simularReemplazoPasoAPaso(motor, referenciasEjemplo());
+}
+
+// ==== Memoria CLOCK / Segunda oportunidad / ARC / OPT ====
+void simularCLOCK() {
+    MotorCLOCK motor(MARCOS_EJEMPLO);
+    simularReemplazoPasoAPaso(motor, referenciasEjemplo());
+}
+
+void simularSegundaOportunidad() {
+    MotorSegundaOportunidad motor(MARCOS_EJEMPLO);
+    simularReemplazoPasoAPaso(motor, referenciasEjemplo());
+}
+
+void simularARC() {
+    MotorARC motor(MARCOS_EJEMPLO);
+    simularReemplazoPasoAPaso(motor, referenciasEjemplo());
+}
+
+void simularOPT() {
+    vector<uint64_t> referencias = referenciasEjemplo();
+    MotorOPT motor(MARCOS_EJEMPLO, referencias);
+    simularReemplazoPasoAPaso(motor, referencias);
+}
+
+// ---- Simulación sobre trazas ----
+
+// Número de referencias que se leen y procesan por bloque
+const size_t TAM_BLOQUE_TRAZA = 1 << 16;
+
+/**
+ * Recorre la traza una sola vez alimentando todos los motores con cada bloque.
+ * Devuelve false si el archivo no se pudo abrir.
+ */
+bool procesarTraza(const string& ruta, vector<PoliticaReemplazo*>& motores) {
+    LectorTraza lector;
+    if (!lector.abrir(ruta)) return false;
+
+    vector<uint64_t> bloque;
+    bloque.reserve(TAM_BLOQUE_TRAZA);
+    while (lector.leerBloque(bloque, TAM_BLOQUE_TRAZA) > 0) {
+        for (size_t m = 0; m < motores.size(); ++m) {
+            PoliticaReemplazo& motor = *motores[m];
+            for (size_t i = 0; i < bloque.size(); ++i)
+                motor.referenciar(bloque[i]);
+        }
+    }
+    return !lector.malformada();
+}
+
+// Muestra solo el resumen de cada motor (sin salida por referencia)
+void mostrarResumenReemplazo(const vector<PoliticaReemplazo*>& motores, double segundos) {
+    cout << "\nPolítica\tMarcos\tReferencias\tFallos\tTasa de fallos\n";
+    for (size_t i = 0; i < motores.size(); ++i) {
+        const PoliticaReemplazo& m = *motores[i];
+        double tasa = m.referencias ? (double)m.fallos / m.referencias : 0.0;
+        cout << m.nombre() << "\t\t" << m.marcos << "\t" << m.referencias << "\t\t"
+             << m.fallos << "\t" << tasa * 100 << " %\n";
+    }
+    cout << "Tiempo de simulación: " << segundos << " s\n";
+}
+
+// Convierte una lista "4,8,16" en cantidades de marcos válidas
+vector<size_t> leerListaMarcos(const string& texto) {
+    vector<size_t> marcos;
+    size_t valor = 0;
+    bool hayDigito = false;
+    for (size_t i = 0; i <= texto.size(); ++i) {
+        if (i < texto.size() && isdigit((unsigned char)texto[i])) {
+            valor = valor * 10 + (texto[i] - '0');
+            hayDigito = true;
+        } else {
+            if (hayDigito && valor > 0) marcos.push_back(valor);
+            valor = 0;
+            hayDigito = false;
+        }
+    }
+    return marcos;
+}
+
+// OPT solo se evalúa si la traza cabe en memoria con este número de referencias
+const size_t LIMITE_REFERENCIAS_OPT = 200000000;
+
+// Carga la traza completa (hasta 'limite' referencias); devuelve false si no se pudo o no cabe
+bool cargarTraza(const string& ruta, size_t limite, vector<uint64_t>& traza) {
+    LectorTraza lector;
+    if (!lector.abrir(ruta)) return false;
+    traza.clear();
+    vector<uint64_t> bloque;
+    while (lector.leerBloque(bloque, TAM_BLOQUE_TRAZA) > 0) {
+        if (traza.size() + bloque.size() > limite) {
+            traza.clear();
+            return false;
+        }
+        traza.insert(traza.end(), bloque.begin(), bloque.end());
+    }
+    if (lector.malformada()) {
+        traza.clear();
+        return false;
+    }
+    return true;
+}
+
+bool menosMarcos(const PoliticaReemplazo* a, const PoliticaReemplazo* b) { return a->marcos < b->marcos; }
+
+/**
+ * Evalúa todas las políticas de flujo sobre una traza en archivo para varias cantidades de
+ * marcos en una sola pasada, y luego OPT sobre la traza cargada (si cabe en memoria).
+ * Deja en 'motores' un motor por política y cantidad de marcos, ordenados por marcos;
+ * quien llama debe liberarlos. Devuelve false si la traza no se pudo abrir.
+ */
+bool evaluarTraza(const string& ruta, const vector<size_t>& marcos, vector<PoliticaReemplazo*>& motores, bool& optOmitido) {
+    for (size_t i = 0; i < marcos.size(); ++i) {
+        for (size_t j = 0; j < NUM_POLITICAS_FLUJO; ++j)
+            motores.push_back(crearMotorReemplazo(POLITICAS_FLUJO[j], marcos[i]));
+    }
+    optOmitido = false;
+    if (!procesarTraza(ruta, motores)) return false;
+
+    // OPT necesita conocer el futuro: se recorre la traza cargada con su índice de próximo uso
+    vector<uint64_t> traza;
+    if (!marcos.empty() && cargarTraza(ruta, LIMITE_REFERENCIAS_OPT, traza)) {
+        for (size_t i = 0; i < marcos.size(); ++i) {
+            MotorOPT* opt = new MotorOPT(marcos[i], traza);
+            for (size_t k = 0; k < traza.size(); ++k) opt->referenciar(traza[k]);
+            motores.push_back(opt);
+        }
+    } else if (!marcos.empty()) {
+        optOmitido = true;
+    }
+    stable_sort(motores.begin(), motores.end(), menosMarcos);
+    return true;
+}
+
+// Simula todas las políticas sobre una traza en archivo, mostrando únicamente el resumen
+void simularTrazaArchivo(const string& ruta, const vector<size_t>& marcos) {
+    vector<PoliticaReemplazo*> motores;
+    bool optOmitido;
+
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    if (!evaluarTraza(ruta, marcos, motores, optOmitido)) {
+        cout << "No se pudo abrir la traza " << ruta << ".\n";
+    } else {
+        double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        if (optOmitido) cout << "La traza es demasiado larga para OPT; se omite.\n";
+        mostrarResumenReemplazo(motores, segundos);
+    }
+
+    for (size_t i = 0; i < motores.size(); ++i)
+        delete motores[i];
+}
+
+// ---- Curva de fallos LRU (distancias de pila de Mattson) ----
+// LRU es un algoritmo de pila: con F marcos, una referencia falla si y solo si su distancia de
+// pila (páginas distintas usadas desde su último acceso, contándola a ella) es mayor que F.
+// Con el histograma de distancias de una sola pasada se obtienen los fallos para todo F.
+// La distancia se calcula con un árbol de Fenwick sobre los instantes de último acceso:
+// cada página marca con 1 solo su acceso más reciente, y contar las marcas posteriores
+// al acceso anterior de la página da su distancia en O(log n).
+
+class ArbolFenwick {
+public:
+    explicit ArbolFenwick(size_t n = 0) : arbol(n + 1, 0) {}
+
+    size_t size() const { return arbol.size() - 1; }
+
+    void sumar(size_t i, int delta) {  // i en [1, n]
+        for (; i < arbol.size(); i += i & (~i + 1)) arbol[i] += delta;
+    }
+
+    long long prefijo(size_t i) const {  // Suma de [1, i]
+        long long s = 0;
+        for (; i > 0; i -= i & (~i + 1)) s += arbol[i];
+        return s;
+    }
+
+private:
+    vector<int> arbol;
+};
+
+/**
+ * Calcula el histograma de distancias de pila LRU de una traza en una sola pasada.
+ * Los instantes se renumeran (compactan) cuando el árbol se llena, así que la memoria
+ * es proporcional al número de páginas distintas y no al largo de la traza.
+ */
+class DistanciasPila {
+public:
+    explicit DistanciasPila(size_t maxMarcos)
+        : histograma(maxMarcos + 1, 0), masLejanas(0), frias(0), referencias(0), instante(0) {
+        arbol = ArbolFenwick(1 << 20);
+    }
+
+    void referenciar(uint64_t pagina) {
+        ++referencias;
+        if (instante == arbol.size()) compactar();
+        size_t ahora = ++instante;
+
+        unordered_map<uint64_t, size_t>::iterator it = ultimo.find(pagina);
+        if (it == ultimo.end()) {
+            ++frias;  // Primera referencia: fallo con cualquier cantidad de marcos
+            ultimo.insert(make_pair(pagina, ahora));
+        } else {
+            // Páginas distintas referenciadas después del último acceso, más la propia
+            long long distancia = arbol.prefijo(ahora - 1) - arbol.prefijo(it->second) + 1;
+            if (distancia < (long long)histograma.size()) ++histograma[distancia];
+            else ++masLejanas;
+            arbol.sumar(it->second, -1);
+            it->second = ahora;
+        }
+        arbol.sumar(ahora, 1);
+    }
+
+    // curva[f] = fallos de LRU con f marcos, para f en 1..máximo (suma de sufijos del histograma)
+    vector<unsigned long long> curva() const {
+        size_t maxMarcos = histograma.size() - 1;
+        vector<unsigned long long> c(maxMarcos + 1, 0);
+        c[maxMarcos] = frias + masLejanas;
+        for (size_t f = maxMarcos - 1; f >= 1; --f)
+            c[f] = c[f + 1] + histograma[f + 1];
+        return c;
+    }
+
+    unsigned long long totalReferencias() const { return referencias; }
+    size_t paginasDistintas() const { return ultimo.size(); }
+
+private:
+    // Renumera los últimos accesos 1..k conservando su orden y reconstruye el árbol
+    void compactar() {
+        vector<pair<size_t, uint64_t> > orden;
+        orden.reserve(ultimo.size());
+        for (unordered_map<uint64_t, size_t>::iterator it = ultimo.begin(); it != ultimo.end(); ++it)
+            orden.push_back(make_pair(it->second, it->first));
+        sort(orden.begin(), orden.end());
+
+        // El árbol crece si las páginas distintas ocupan más de la mitad
+        size_t capacidad = max(arbol.size(), 2 * orden.size() + 1);
+        arbol = ArbolFenwick(capacidad);
+        for (size_t i = 0; i < orden.size(); ++i) {
+            ultimo[orden[i].second] = i + 1;
+            arbol.sumar(i + 1, 1);
+        }
+        instante = orden.size();
+    }
+
+    vector<unsigned long long> histograma;  // histograma[d] = referencias con distancia d
+    unsigned long long masLejanas;          // Distancias mayores que el máximo de marcos
+    unsigned long long frias;               // Primeras referencias (fallos obligatorios)
+    unsigned long long referencias;
+    ArbolFenwick arbol;
+    size_t instante;                        // Último instante asignado
+    unordered_map<uint64_t, size_t> ultimo; // Página -> instante de su último acceso
+};
+
+// Muestra fallos vs. marcos para 1..maxMarcos a partir de una sola pasada por la traza
+void curvaFallosLRU(const string& ruta, size_t maxMarcos) {
+    LectorTraza lector;
+    if (maxMarcos == 0 || !lector.abrir(ruta)) {
+        cout << "No se pudo abrir la traza " << ruta << ".\n";
+        return;
+    }
+
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    DistanciasPila pila(maxMarcos);
+    vector<uint64_t> bloque;
+    bloque.reserve(TAM_BLOQUE_TRAZA);
+    while (lector.leerBloque(bloque, TAM_BLOQUE_TRAZA) > 0) {
+        for (size_t i = 0; i < bloque.size(); ++i)
+            pila.referenciar(bloque[i]);
+    }
+    if (lector.malformada()) {
+        cout << "No se pudo leer la traza " << ruta << ".\n";
+        return;
+    }
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    cout << "\nCurva de fallos LRU (" << pila.totalReferencias() << " referencias, "
+         << pila.paginasDistintas() << " páginas distintas)\n";
+    cout << "Marcos\tFallos\tTasa de fallos\n";
+    vector<unsigned long long> curva = pila.curva();
+    for (size_t f = 1; f <= maxMarcos; ++f) {
+        double tasa = pila.totalReferencias() ? (double)curva[f] / pila.totalReferencias() : 0.0;
+        cout << f << "\t" << curva[f] << "\t" << tasa * 100 << " %\n";
+    }
+    cout << "Tiempo de simulación: " << segundos << " s\n";
+}
+
+// ---- Traducción de direcciones ----
+// Capa previa a los motores de reemplazo que recibe direcciones virtuales: busca la página en
+// una TLB asociativa por conjuntos y, si no está, recorre una tabla de páginas multinivel. Si la
+// página no está mapeada hay un fallo de página y el motor de reemplazo elige qué marco liberar;
+// la página desalojada se desmapea de la tabla y se invalida en la TLB.
+
+enum ReemplazoTLB { TLB_LRU, TLB_FIFO, TLB_ALEATORIO };
+const char* const NOMBRES_REEMPLAZO_TLB[] = {"lru", "fifo", "aleatorio"};
+
+struct ConfigTraduccion {
+    int bitsDireccion;      // Ancho de la dirección virtual
+    int bitsPagina;         // log2 del tamaño de página
+    int niveles;            // Niveles de la tabla de páginas
+    size_t entradasTLB;
+    size_t viasTLB;         // Entradas por conjunto (entradasTLB = asociativa completa)
+    ReemplazoTLB reemplazoTLB;
+    size_t marcos;          // Marcos físicos
+    string politicaMarcos;  // Motor de reemplazo de páginas (FIFO, LRU, CLOCK, ...)
+};
+
+// Costos en nanosegundos para estimar el tiempo efectivo de acceso
+struct CostosAcceso {
+    double tlb;      // Consulta a la TLB
+    double memoria;  // Un acceso a memoria (dato o entrada de la tabla)
+    double fallo;    // Atender un fallo de página
+};
+
+const CostosAcceso COSTOS_ACCESO_DEFECTO = {1, 100, 8000000};
+
+// Ningún nivel de la tabla puede tener más de 2^MAX_BITS_NIVEL entradas
+const int MAX_BITS_NIVEL = 20;
+
+// Bits de índice que le tocan a cada nivel (el primero absorbe el resto de la división)
+vector<int> bitsPorNivel(int bitsVPN, int niveles) {
+    vector<int> bits(niveles, bitsVPN / niveles);
+    bits[0] += bitsVPN % niveles;
+    return bits;
+}
+
+bool configTraduccionValida(const ConfigTraduccion& cfg) {
+    if (cfg.bitsPagina < 6 || cfg.bitsPagina > 30 || cfg.bitsDireccion <= cfg.bitsPagina || cfg.bitsDireccion > 64)
+        return false;
+    if (cfg.niveles < 1 || cfg.niveles > cfg.bitsDireccion - cfg.bitsPagina) return false;
+    if (bitsPorNivel(cfg.bitsDireccion - cfg.bitsPagina, cfg.niveles)[0] > MAX_BITS_NIVEL) return false;
+    if (cfg.viasTLB < 1 || cfg.entradasTLB < cfg.viasTLB || cfg.entradasTLB % cfg.viasTLB != 0) return false;
+    PoliticaReemplazo* prueba = cfg.marcos > 0 ? crearMotorReemplazo(cfg.politicaMarcos, cfg.marcos) : nullptr;
+    delete prueba;
+    return prueba != nullptr;
+}
+
+/**
+ * TLB asociativa por conjuntos: el número de página elige el conjunto y se compara con
+ * las etiquetas de sus vías. La víctima dentro del conjunto sale por LRU, FIFO o al azar.
+ */
+class TLBAsociativa {
+public:
+    TLBAsociativa(size_t entradas, size_t vias, ReemplazoTLB politica)
+        : conjuntos(entradas / vias), vias(vias), politica(politica), etiquetas(entradas, 0), validas(entradas, 0),
+          marcas(entradas, 0), reloj(0), azar(1) {}
+
+    bool buscar(uint64_t pagina) {
+        size_t base = (size_t)(pagina % conjuntos) * vias;
+        for (size_t i = base; i < base + vias; ++i) {
+            if (validas[i] && etiquetas[i] == pagina) {
+                if (politica == TLB_LRU) marcas[i] = ++reloj;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void insertar(uint64_t pagina) {
+        size_t base = (size_t)(pagina % conjuntos) * vias;
+        size_t victima = base;
+        for (size_t i = base; i < base + vias; ++i) {
+            if (!validas[i]) {
+                victima = i;
+                break;
+            }
+            if (marcas[i] < marcas[victima]) victima = i;  // Con LRU y FIFO: la marca más vieja
+        }
+        if (validas[victima] && politica == TLB_ALEATORIO) victima = base + (size_t)(azar() % vias);
+        etiquetas[victima] = pagina;
+        validas[victima] = 1;
+        marcas[victima] = ++reloj;
+    }
+
+    void invalidar(uint64_t pagina) {
+        size_t base = (size_t)(pagina % conjuntos) * vias;
+        for (size_t i = base; i < base + vias; ++i) {
+            if (validas[i] && etiquetas[i] == pagina) validas[i] = 0;
+        }
+    }
+
+private:
+    size_t conjuntos, vias;
+    ReemplazoTLB politica;
+    vector<uint64_t> etiquetas;  // Número de página de cada entrada
+    vector<char> validas;
+    vector<uint64_t> marcas;     // Último uso (LRU) o instante de carga (FIFO)
+    uint64_t reloj;
+    mt19937_64 azar;
+};
+
+/**
+ * Tabla de páginas multinivel (árbol radix). Los nodos se guardan uno tras otro en un solo
+ * vector: una entrada interna tiene la posición de su hijo más uno (0 = sin hijo) y una
+ * entrada del último nivel vale 1 si la página está mapeada. Los nodos intermedios se
+ * crean al mapear la primera página que los necesita, así que una traza dispersa en un
+ * espacio de 48 bits solo ocupa los nodos que toca.
+ */
+class TablaPaginasMultinivel {
+public:
+    TablaPaginasMultinivel(int bitsVPN, int niveles) : bits(bitsPorNivel(bitsVPN, niveles)), nodos(0) {
+        corrimientos.resize(niveles);
+        int acumulado = 0;
+        for (int n = niveles - 1; n >= 0; --n) {
+            corrimientos[n] = acumulado;
+            acumulado += bits[n];
+        }
+        nuevoNodo(0);  // Raíz en la posición 0
+    }
+
+    // Recorre la tabla; 'accesos' recibe las entradas leídas (se detiene en la primera vacía)
+    bool presente(uint64_t pagina, int& accesos) const {
+        size_t nodo = 0;
+        accesos = 0;
+        for (size_t n = 0; n < bits.size(); ++n) {
+            uint32_t entrada = entradas[nodo + indice(pagina, n)];
+            ++accesos;
+            if (entrada == 0) return false;
+            nodo = entrada - 1;
+        }
+        return true;
+    }
+
+    void mapear(uint64_t pagina) {
+        size_t nodo = 0;
+        for (size_t n = 0; n + 1 < bits.size(); ++n) {
+            size_t i = nodo + indice(pagina, n);
+            if (entradas[i] == 0) {
+                uint32_t hijo = (uint32_t)nuevoNodo(n + 1);
+                entradas[i] = hijo + 1;  // nuevoNodo puede mover el vector: se escribe después
+            }
+            nodo = entradas[i] - 1;
+        }
+        entradas[nodo + indice(pagina, bits.size() - 1)] = 1;
+    }
+
+    void desmapear(uint64_t pagina) {
+        size_t nodo = 0;
+        for (size_t n = 0; n + 1 < bits.size(); ++n) {
+            uint32_t entrada = entradas[nodo + indice(pagina, n)];
+            if (entrada == 0) return;
+            nodo = entrada - 1;
+        }
+        entradas[nodo + indice(pagina, bits.size() - 1)] = 0;
+    }
+
+    size_t totalNodos() const { return nodos; }
+    size_t bytes() const { return entradas.size() * sizeof(uint32_t); }
+
+private:
+    size_t indice(uint64_t pagina, size_t nivel) const {
+        return (size_t)((pagina >> corrimientos[nivel]) & ((1ULL << bits[nivel]) - 1));
+    }
+
+    size_t nuevoNodo(size_t nivel) {
+        size_t posicion = entradas.size();
+        entradas.resize(posicion + ((size_t)1 << bits[nivel]), 0);
+        ++nodos;
+        return posicion;
+    }
+
+    vector<int> bits;          // Bits de índice de cada nivel, de la raíz a las hojas
+    vector<int> corrimientos;  // Desplazamiento del índice de cada nivel dentro del número de página
+    vector<uint32_t> entradas;
+    size_t nodos;
+};
+
+/**
+ * Traduce direcciones virtuales con TLB, tabla multinivel y un motor de reemplazo para los
+ * marcos físicos, y cuenta por separado aciertos y fallos de TLB, recorridos de la tabla
+ * (con las entradas que leyeron) y fallos de página.
+ */
+class TraductorDirecciones {
+public:
+    explicit TraductorDirecciones(const ConfigTraduccion& cfg)
+        : cfg(cfg), tlb(cfg.entradasTLB, cfg.viasTLB, cfg.reemplazoTLB),
+          tabla(cfg.bitsDireccion - cfg.bitsPagina, cfg.niveles), motor(crearMotorReemplazo(cfg.politicaMarcos, cfg.marcos)),
+          mascaraVPN(cfg.bitsDireccion - cfg.bitsPagina >= 64 ? ~0ULL : (1ULL << (cfg.bitsDireccion - cfg.bitsPagina)) - 1),
+          referencias(0), aciertosTLB(0), recorridos(0), accesosTabla(0), fallosPagina(0) {}
+    ~TraductorDirecciones() { delete motor; }
+
+    void traducir(uint64_t direccion) {
+        uint64_t pagina = (direccion >> cfg.bitsPagina) & mascaraVPN;
+        ++referencias;
+        if (tlb.buscar(pagina)) {
+            ++aciertosTLB;
+            motor->referenciar(pagina);  // Mantiene al día la recencia del motor (siempre residente)
+            return;
+        }
+
+        int accesos;
+        bool mapeada = tabla.presente(pagina, accesos);
+        ++recorridos;
+        accesosTabla += accesos;
+        motor->referenciar(pagina);
+        if (!mapeada) {
+            ++fallosPagina;
+            if (motor->huboReemplazo) {
+                tabla.desmapear(motor->victima);
+                tlb.invalidar(motor->victima);
+            }
+            tabla.mapear(pagina);
+        }
+        tlb.insertar(pagina);
+    }
+
+    void procesarBloque(const vector<uint64_t>& bloque) {
+        for (size_t i = 0; i < bloque.size(); ++i) traducir(bloque[i]);
+    }
+
+    // Tiempo promedio por referencia: TLB y dato siempre, más las entradas leídas en los
+    // recorridos y la atención de los fallos de página
+    double tiempoEfectivo(const CostosAcceso& costos) const {
+        if (referencias == 0) return 0.0;
+        return costos.tlb + costos.memoria + ((double)accesosTabla * costos.memoria + (double)fallosPagina * costos.fallo) / referencias;
+    }
+
+    // Memoria que cubre la TLB llena
+    uint64_t alcanceTLB() const { return (uint64_t)cfg.entradasTLB << cfg.bitsPagina; }
+
+    const ConfigTraduccion cfg;
+    TLBAsociativa tlb;
+    TablaPaginasMultinivel tabla;
+    PoliticaReemplazo* motor;
+    uint64_t mascaraVPN;
+    unsigned long long referencias, aciertosTLB, recorridos, accesosTabla, fallosPagina;
+
+private:
+    TraductorDirecciones(const TraductorDirecciones&);  // No copiable: es dueño del motor
+    TraductorDirecciones& operator=(const TraductorDirecciones&);
+};
+
+// Recorre la traza de direcciones una sola vez alimentando todos los traductores por bloques
+bool procesarTrazaDirecciones(const string& ruta, vector<TraductorDirecciones*>& traductores) {
+    LectorTraza lector;
+    if (!lector.abrir(ruta)) return false;
+
+    vector<uint64_t> bloque;
+    bloque.reserve(TAM_BLOQUE_TRAZA);
+    while (lector.leerBloque(bloque, TAM_BLOQUE_TRAZA) > 0) {
+        for (size_t t = 0; t < traductores.size(); ++t)
+            traductores[t]->procesarBloque(bloque);
+    }
+    return !lector.malformada();
+}
+
+// Tamaño en bytes con la mayor unidad binaria que no lo deja por debajo de 1
+string tamLegible(uint64_t bytes) {
+    const char* unidades[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+    double valor = (double)bytes;
+    int u = 0;
+    while (u < 4 && valor >= 1024) {
+        valor /= 1024;
+        ++u;
+    }
+    char texto[32];
+    snprintf(texto, sizeof(texto), "%.4g %s", valor, unidades[u]);
+    return texto;
+}
+
+void mostrarResumenTraduccion(const vector<TraductorDirecciones*>& traductores, const CostosAcceso& costos, double segundos) {
+    cout << "\nPágina\tNiveles\tAlcance TLB\tAciertos TLB\tRecorridos\tAccesos a tabla\tFallos de página\t"
+            "Tabla\t\tTEA (ns)\n";
+    for (size_t i = 0; i < traductores.size(); ++i) {
+        const TraductorDirecciones& t = *traductores[i];
+        double aciertos = t.referencias ? 100.0 * t.aciertosTLB / t.referencias : 0.0;
+        cout << tamLegible(1ULL << t.cfg.bitsPagina) << "\t" << t.cfg.niveles << "\t" << tamLegible(t.alcanceTLB())
+             << "\t\t" << aciertos << " %\t" << t.recorridos << "\t\t" << t.accesosTabla << "\t\t"
+             << t.fallosPagina << "\t\t\t" << tamLegible(t.tabla.bytes()) << "\t" << t.tiempoEfectivo(costos) << "\n";
+    }
+    if (!traductores.empty())
+        cout << "Referencias: " << traductores[0]->referencias << ", marcos: " << traductores[0]->cfg.marcos
+             << " (" << traductores[0]->cfg.politicaMarcos << ")\n";
+    cout << "Tiempo de simulación: " << segundos << " s\n";
+}
+
+/**
+ * Traduce una traza de direcciones virtuales con cada tamaño de página de la lista (en bits)
+ * y el resto de la configuración fija, para comparar cómo influyen el tamaño de página y el
+ * alcance de la TLB en el tiempo efectivo de acceso.
+ */
+void simularTraduccion(const string& ruta, const vector<size_t>& bitsPagina, ConfigTraduccion cfg) {
+    vector<TraductorDirecciones*> traductores;
+    for (size_t i = 0; i < bitsPagina.size(); ++i) {
+        cfg.bitsPagina = (int)bitsPagina[i];
+        if (configTraduccionValida(cfg)) traductores.push_back(new TraductorDirecciones(cfg));
+        else cout << "Configuración inválida con páginas de " << bitsPagina[i] << " bits; se omite.\n";
+    }
+
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    if (traductores.empty()) {
+        cout << "No hay configuraciones válidas.\n";
+    } else if (!procesarTrazaDirecciones(ruta, traductores)) {
+        cout << "No se pudo abrir la traza " << ruta << ".\n";
+    } else {
+        double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+        mostrarResumenTraduccion(traductores, COSTOS_ACCESO_DEFECTO, segundos);
+    }
+
+    for (size_t i = 0; i < traductores.size(); ++i)
+        delete traductores[i];
+}
+
+// ==== Asignación de memoria física ====
+// Simula cómo el núcleo entrega memoria física. Hay dos asignadores con la misma interfaz:
+//  - Buddy: bloques de 2^k unidades mínimas. Cada orden tiene una lista libre intrusiva y un
+//    mapa de bits que dice qué bloques están libres, así que encontrar y fusionar el compañero
+//    cuesta O(1) por nivel. Una máscara de órdenes no vacíos elige el primer orden útil con
+//    una sola instrucción de búsqueda de bit.
+//  - Slab: cachés de objetos de 16 a 4096 bytes sobre un buddy de páginas. Cada slab marca sus
+//    objetos libres en un mapa de bits, y las peticiones grandes van directo a páginas del buddy.
+// Las cargas son trazas de reservas y liberaciones (o generadas con semilla) que se repiten
+// igual sobre cada asignador.
+
+const uint64_t SIN_MEMORIA = ~0ULL;  // Dirección devuelta cuando no hay espacio
+const uint64_t TAM_PAGINA_FISICA = 4096;
+
+// Menor orden k con 2^k >= unidades
+inline int ordenPara(uint64_t unidades) {
+    return unidades <= 1 ? 0 : bitMasAlto(unidades - 1) + 1;
+}
+
+/**
+ * Base de los asignadores: lleva la cuenta de los bytes pedidos y del pico de memoria física
+ * ocupada. Cada asignador solo decide dónde colocar y cómo recuperar los bloques.
+ * Las liberaciones indican el tamaño pedido, como kmem_cache_free o free_pages en Linux.
+ */
+class AsignadorMemoria {
+public:
+    AsignadorMemoria() : pedido(0), huellaPico(0), fallidas(0) {}
+    virtual ~AsignadorMemoria() {}
+
+    virtual string nombre() const = 0;
+
+    // Reserva 'tam' bytes; devuelve la dirección física o SIN_MEMORIA
+    uint64_t reservar(size_t tam) {
+        uint64_t direccion = asignar(max<size_t>(tam, 1));
+        if (direccion == SIN_MEMORIA) {
+            ++fallidas;
+            return direccion;
+        }
+        pedido += tam;
+        huellaPico = max(huellaPico, huella());
+        return direccion;
+    }
+
+    void liberar(uint64_t direccion, size_t tam) {
+        devolver(direccion, max<size_t>(tam, 1));
+        pedido -= tam;
+    }
+
+    // Bytes de memoria física ocupados (bloques o páginas entregados, con su redondeo)
+    virtual uint64_t huella() const = 0;
+
+    // 1 - (mayor bloque libre / memoria libre): cuánto de lo libre no sirve para una petición grande
+    virtual double fragmentacionExterna() const = 0;
+
+    // Parte de la memoria ocupada que no se pidió (redondeos y objetos sin usar en los slabs)
+    double fragmentacionInterna() const {
+        uint64_t h = huella();
+        return h ? 1.0 - (double)pedido / h : 0.0;
+    }
+
+    uint64_t pedido;      // Bytes pedidos por las reservas vivas
+    uint64_t huellaPico;  // Máxima huella observada
+    uint64_t fallidas;    // Reservas sin espacio
+
+protected:
+    virtual uint64_t asignar(size_t tam) = 0;
+    virtual void devolver(uint64_t direccion, size_t tam) = 0;
+};
+
+class AsignadorBuddy : public AsignadorMemoria {
+public:
+    // 'memoria' y 'minBloque' deben ser potencias de 2, con memoria >= minBloque
+    AsignadorBuddy(uint64_t memoria, uint64_t minBloque)
+        : minBloque(minBloque), ordenMax(bitMasAlto(memoria / minBloque)), bloques(memoria / minBloque),
+          siguiente(bloques), anterior(bloques), cabezas(ordenMax + 1, (uint32_t)NINGUNO), libres(ordenMax + 1),
+          ordenesConLibres(0), ocupado(0) {
+        for (int k = 0; k <= ordenMax; ++k)
+            libres[k].assign(((bloques >> k) + 63) / 64, 0);
+        meter(0, ordenMax);
+    }
+
+    string nombre() const { return "Buddy"; }
+    uint64_t huella() const { return ocupado; }
+    double fragmentacionExterna() const {
+        uint64_t libre = (bloques * minBloque) - ocupado;
+        if (libre == 0) return 0.0;
+        return 1.0 - (double)(minBloque << bitMasAlto(ordenesConLibres)) / libre;
+    }
+
+    // Reserva un bloque de 2^orden unidades; devuelve su primera unidad o -1
+    int64_t reservarBloque(int orden) {
+        if (orden > ordenMax) return -1;
+        uint64_t candidatos = ordenesConLibres & ~((1ULL << orden) - 1);
+        if (!candidatos) return -1;
+        int k = primerBitEncendido(candidatos);
+        uint32_t i = cabezas[k];
+        quitar(i, k);
+        while (k > orden) {  // Divide y deja libre la mitad superior
+            --k;
+            meter(i + (1u << k), k);
+        }
+        ocupado += minBloque << orden;
+        return i;
+    }
+
+    // Devuelve un bloque y lo fusiona con su compañero mientras este también esté libre
+    void liberarBloque(uint32_t i, int orden) {
+        ocupado -= minBloque << orden;
+        while (orden < ordenMax) {
+            uint32_t companero = i ^ (1u << orden);
+            if (!estaLibre(companero, orden)) break;
+            quitar(companero, orden);
+            i = min(i, companero);
+            ++orden;
+        }
+        meter(i, orden);
+    }
+
+    const uint64_t minBloque;
+
+protected:
+    uint64_t asignar(size_t tam) {
+        int64_t i = reservarBloque(ordenPara((tam + minBloque - 1) / minBloque));
+        return i < 0 ? SIN_MEMORIA : (uint64_t)i * minBloque;
+    }
+
+    void devolver(uint64_t direccion, size_t tam) {
+        liberarBloque((uint32_t)(direccion / minBloque), ordenPara((tam + minBloque - 1) / minBloque));
+    }
+
+private:
+    static const uint32_t NINGUNO = 0xFFFFFFFFu;
+
+    bool estaLibre(uint32_t i, int k) const {
+        uint64_t bit = i >> k;
+        return (libres[k][bit / 64] >> (bit % 64)) & 1;
+    }
+
+    void meter(uint32_t i, int k) {
+        uint64_t bit = i >> k;
+        libres[k][bit / 64] |= 1ULL << (bit % 64);
+        siguiente[i] = cabezas[k];
+        anterior[i] = NINGUNO;
+        if (cabezas[k] != NINGUNO) anterior[cabezas[k]] = i;
+        cabezas[k] = i;
+        ordenesConLibres |= 1ULL << k;
+    }
+
+    void quitar(uint32_t i, int k) {
+        uint64_t bit = i >> k;
+        libres[k][bit / 64] &= ~(1ULL << (bit % 64));
+        if (anterior[i] != NINGUNO) siguiente[anterior[i]] = siguiente[i];
+        else cabezas[k] = siguiente[i];
+        if (siguiente[i] != NINGUNO) anterior[siguiente[i]] = anterior[i];
+        if (cabezas[k] == NINGUNO) ordenesConLibres &= ~(1ULL << k);
+    }
+
+    int ordenMax;
+    uint64_t bloques;                  // Unidades mínimas en la memoria
+    vector<uint32_t> siguiente;        // Listas libres intrusivas, indexadas por unidad
+    vector<uint32_t> anterior;
+    vector<uint32_t> cabezas;          // Primer bloque libre de cada orden
+    vector<vector<uint64_t> > libres;  // libres[k]: bit j encendido si el bloque j de orden k está libre
+    uint64_t ordenesConLibres;         // Bit k encendido si la lista del orden k no está vacía
+    uint64_t ocupado;                  // Bytes en bloques reservados
+};
+
+/**
+ * Asignador slab: una caché por tamaño de objeto (potencias de 2 entre 16 y 4096 bytes). Un slab
+ * es un bloque del buddy de páginas dividido en objetos iguales, con un mapa de bits de libres.
+ * Los slabs con objetos libres forman una lista por caché; cada caché guarda un slab vacío
+ * para no devolver y volver a pedir páginas cuando el uso oscila en el borde.
+ */
+class AsignadorSlab : public AsignadorMemoria {
+public:
+    explicit AsignadorSlab(uint64_t memoria)
+        : paginas(memoria, TAM_PAGINA_FISICA), slabEnPagina(memoria / TAM_PAGINA_FISICA, -1) {
+        for (uint32_t tam = OBJETO_MIN; tam <= OBJETO_MAX; tam *= 2) {
+            uint64_t bytesSlab = max<uint64_t>(TAM_PAGINA_FISICA, 8ULL * tam);
+            CacheObjetos c = {tam, (uint32_t)(bytesSlab / tam), ordenPara(bytesSlab / TAM_PAGINA_FISICA), -1, -1};
+            caches.push_back(c);
+        }
+    }
+
+    string nombre() const { return "Slab"; }
+    uint64_t huella() const { return paginas.huella(); }
+    double fragmentacionExterna() const { return paginas.fragmentacionExterna(); }
+
+protected:
+    uint64_t asignar(size_t tam) {
+        if (tam > OBJETO_MAX) {
+            int64_t p = paginas.reservarBloque(ordenPara((tam + TAM_PAGINA_FISICA - 1) / TAM_PAGINA_FISICA));
+            return p < 0 ? SIN_MEMORIA : (uint64_t)p * TAM_PAGINA_FISICA;
+        }
+
+        int c = cacheDe(tam);
+        CacheObjetos& cache = caches[c];
+        int s = cache.parciales;
+        if (s == -1) {
+            if (cache.vacia != -1) {
+                s = cache.vacia;
+                cache.vacia = -1;
+            } else if ((s = nuevoSlab(c)) == -1) {
+                return SIN_MEMORIA;
+            }
+            meterParcial(cache, s);
+        }
+
+        Slab& slab = slabs[s];
+        int w = 0;
+        while (!slab.mapa[w]) ++w;
+        int b = primerBitEncendido(slab.mapa[w]);
+        slab.mapa[w] &= slab.mapa[w] - 1;
+        if (--slab.libres == 0) quitarParcial(cache, s);
+        return slab.base + (uint64_t)(w * 64 + b) * cache.tamObjeto;
+    }
+
+    void devolver(uint64_t direccion, size_t tam) {
+        if (tam > OBJETO_MAX) {
+            paginas.liberarBloque((uint32_t)(direccion / TAM_PAGINA_FISICA),
+                                  ordenPara((tam + TAM_PAGINA_FISICA - 1) / TAM_PAGINA_FISICA));
+            return;
+        }
+
+        CacheObjetos& cache = caches[cacheDe(tam)];
+        uint64_t bytesSlab = TAM_PAGINA_FISICA << cache.ordenSlab;
+        uint64_t base = direccion & ~(bytesSlab - 1);  // Los bloques del buddy están alineados a su tamaño
+        int s = slabEnPagina[base / TAM_PAGINA_FISICA];
+        Slab& slab = slabs[s];
+        uint32_t objeto = (uint32_t)((direccion - base) / cache.tamObjeto);
+        slab.mapa[objeto / 64] |= 1ULL << (objeto % 64);
+        if (slab.libres++ == 0) meterParcial(cache, s);
+        if (slab.libres == cache.objetos) {
+            quitarParcial(cache, s);
+            if (cache.vacia == -1) cache.vacia = s;
+            else liberarSlab(cache, s);
+        }
+    }
+
+private:
+    static const uint32_t OBJETO_MIN = 16, OBJETO_MAX = 4096;
+
+    struct Slab {
+        uint64_t base;     // Dirección del primer objeto
+        uint32_t libres;
+        int32_t sig, ant;  // Lista de slabs con objetos libres de su caché
+        uint64_t mapa[4];  // Bit encendido = objeto libre (a lo sumo 256 objetos por slab)
+    };
+
+    struct CacheObjetos {
+        uint32_t tamObjeto;
+        uint32_t objetos;   // Objetos por slab
+        int ordenSlab;      // Páginas por slab (2^ordenSlab)
+        int32_t parciales;  // Primer slab con objetos libres (-1 si no hay)
+        int32_t vacia;      // Slab vacío reservado para la próxima petición (-1 si no hay)
+    };
+
+    static int cacheDe(size_t tam) { return ordenPara((tam + OBJETO_MIN - 1) / OBJETO_MIN); }
+
+    int nuevoSlab(int c) {
+        CacheObjetos& cache = caches[c];
+        int64_t p = paginas.reservarBloque(cache.ordenSlab);
+        if (p < 0) return -1;
+        int s;
+        if (!slabsLibres.empty()) {
+            s = slabsLibres.back();
+            slabsLibres.pop_back();
+        } else {
+            s = (int)slabs.size();
+            slabs.push_back(Slab());
+        }
+        Slab& slab = slabs[s];
+        slab.base = (uint64_t)p * TAM_PAGINA_FISICA;
+        slab.libres = cache.objetos;
+        slab.sig = slab.ant = -1;
+        for (uint32_t w = 0; w < 4; ++w) {
+            uint32_t desde = w * 64;
+            slab.mapa[w] = cache.objetos >= desde + 64 ? ~0ULL
+                         : cache.objetos > desde    ? (1ULL << (cache.objetos - desde)) - 1 : 0;
+        }
+        slabEnPagina[slab.base / TAM_PAGINA_FISICA] = s;
+        return s;
+    }
+
+    void liberarSlab(const CacheObjetos& cache, int s) {
+        slabEnPagina[slabs[s].base / TAM_PAGINA_FISICA] = -1;
+        paginas.liberarBloque((uint32_t)(slabs[s].base / TAM_PAGINA_FISICA), cache.ordenSlab);
+        slabsLibres.push_back(s);
+    }
+
+    void meterParcial(CacheObjetos& cache, int s) {
+        slabs[s].ant = -1;
+        slabs[s].sig = cache.parciales;
+        if (cache.parciales != -1) slabs[cache.parciales].ant = s;
+        cache.parciales = s;
+    }
+
+    void quitarParcial(CacheObjetos& cache, int s) {
+        Slab& slab = slabs[s];
+        if (slab.ant != -1) slabs[slab.ant].sig = slab.sig;
+        else cache.parciales = slab.sig;
+        if (slab.sig != -1) slabs[slab.sig].ant = slab.ant;
+        slab.sig = slab.ant = -1;
+    }
+
+    AsignadorBuddy paginas;        // Proveedor de páginas de los slabs y de las peticiones grandes
+    vector<CacheObjetos> caches;
+    vector<Slab> slabs;
+    vector<int> slabsLibres;       // Registros de slab reutilizables
+    vector<int32_t> slabEnPagina;  // Slab que empieza en cada página (-1 si ninguno)
+};
+
+// ---- Cargas de reservas y liberaciones ----
+
+// Una reserva (tam > 0) o la liberación (tam = 0) del bloque con ese identificador
+struct OperacionMemoria {
+    uint32_t id;
+    uint32_t tam;
+};
+
+struct ConfigCargaMemoria {
+    size_t operaciones;
+    uint64_t semilla;
+    uint32_t tamMin, tamMax;  // Tamaños log-uniformes: abundan los objetos pequeños
+    size_t vivosMax;          // Bloques vivos como máximo
+};
+
+// Genera una secuencia reproducible que reserva algo más de lo que libera hasta llegar a vivosMax
+vector<OperacionMemoria> generarCargaMemoria(const ConfigCargaMemoria& cfg) {
+    mt19937_64 azar(cfg.semilla);
+    uniform_real_distribution<double> uniforme(0.0, 1.0);
+    double logMin = log((double)cfg.tamMin), logMax = log((double)cfg.tamMax);
+    vector<OperacionMemoria> ops;
+    ops.reserve(cfg.operaciones);
+    vector<uint32_t> vivos;
+    uint32_t siguienteId = 0;
+    while (ops.size() < cfg.operaciones) {
+        if (vivos.empty() || (vivos.size() < cfg.vivosMax && uniforme(azar) < 0.55)) {
+            uint32_t tam = (uint32_t)exp(logMin + (logMax - logMin) * uniforme(azar));
+            OperacionMemoria op = {siguienteId, max(tam, cfg.tamMin)};
+            vivos.push_back(siguienteId++);
+            ops.push_back(op);
+        } else {
+            size_t i = (size_t)(azar() % vivos.size());
+            OperacionMemoria op = {vivos[i], 0};
+            vivos[i] = vivos.back();
+            vivos.pop_back();
+            ops.push_back(op);
+        }
+    }
+    return ops;
+}
+
+/**
+ * Carga una traza de texto con líneas "a id bytes" (reservar) y "f id" (liberar); las líneas
+ * con # se ignoran. Los identificadores se renumeran de forma compacta.
+ */
+bool cargarTrazaAsignacion(const string& ruta, vector<OperacionMemoria>& ops) {
+    ifstream archivo(ruta.c_str());
+    if (!archivo) return false;
+    unordered_map<uint64_t, uint32_t> compacto;
+    string tipo;
+    uint64_t id, tam;
+    while (archivo >> tipo) {
+        if (tipo[0] == '#') {
+            getline(archivo, tipo);
+            continue;
+        }
+        if (!(archivo >> id)) return false;
+        if (tipo == "a") {
+            if (!(archivo >> tam) || tam == 0 || tam > 0xFFFFFFFFu) return false;
+            uint32_t nuevo = (uint32_t)compacto.size();
+            compacto[id] = nuevo;
+            OperacionMemoria op = {nuevo, (uint32_t)tam};
+            ops.push_back(op);
+        } else if (tipo == "f") {
+            unordered_map<uint64_t, uint32_t>::iterator it = compacto.find(id);
+            if (it == compacto.end()) return false;
+            OperacionMemoria op = {it->second, 0};
+            ops.push_back(op);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+struct ResultadoAsignador {
+    string nombre;
+    size_t operaciones;
+    uint64_t fallidas;
+    double segundos;
+    double operacionesPorSegundo;
+    HistogramaLog latenciaReserva, latenciaLiberacion;  // Nanosegundos por operación
+    double fragmentacionInterna, fragmentacionExterna;  // Al terminar la carga
+    uint64_t huellaPico;
+};
+
+// Costo en nanosegundos de un par de lecturas del reloj seguidas (mediana de varias muestras),
+// que se descuenta de cada latencia medida
+long long costoReloj() {
+    static long long costo = -1;
+    if (costo < 0) {
+        vector<long long> muestras(1001);
+        for (size_t i = 0; i < muestras.size(); ++i) {
+            chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+            muestras[i] = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - t0).count();
+        }
+        nth_element(muestras.begin(), muestras.begin() + muestras.size() / 2, muestras.end());
+        costo = muestras[muestras.size() / 2];
+    }
+    return costo;
+}
+
+/**
+ * Recorre la carga sobre el asignador; las liberaciones de bloques cuya reserva falló se omiten.
+ * Con 'medir' cada operación se cronometra por separado (descontando el costo del reloj) y se
+ * registra en 'r'; sin él no hay relojes dentro del ciclo.
+ */
+template <bool medir>
+void recorrerCarga(AsignadorMemoria& asignador, const vector<OperacionMemoria>& ops, ResultadoAsignador& r) {
+    uint32_t ids = 0;
+    for (size_t i = 0; i < ops.size(); ++i) ids = max(ids, ops[i].id + 1);
+    vector<uint64_t> direccion(ids, SIN_MEMORIA);
+    vector<uint32_t> tam(ids, 0);
+    long long costo = medir ? costoReloj() : 0;
+
+    for (size_t i = 0; i < ops.size(); ++i) {
+        const OperacionMemoria& op = ops[i];
+        if (op.tam == 0 && direccion[op.id] == SIN_MEMORIA) continue;
+        chrono::steady_clock::time_point t0;
+        if (medir) t0 = chrono::steady_clock::now();
+        if (op.tam > 0) {
+            direccion[op.id] = asignador.reservar(op.tam);
+            tam[op.id] = op.tam;
+        } else {
+            asignador.liberar(direccion[op.id], tam[op.id]);
+            direccion[op.id] = SIN_MEMORIA;
+        }
+        if (medir) {
+            long long ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - t0).count();
+            (op.tam > 0 ? r.latenciaReserva : r.latenciaLiberacion).registrar(max(0LL, ns - costo));
+        }
+    }
+}
+
+/**
+ * Mide el rendimiento con una pasada sin relojes por operación sobre 'asignador' (de ella salen
+ * también las fallas, la fragmentación y la huella) y las latencias con otra pasada de la misma
+ * carga sobre 'muestreo', un asignador nuevo igual al primero.
+ */
+ResultadoAsignador ejecutarAsignador(AsignadorMemoria& asignador, AsignadorMemoria& muestreo,
+                                     const vector<OperacionMemoria>& ops) {
+    ResultadoAsignador r;
+    r.nombre = asignador.nombre();
+    r.operaciones = ops.size();
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    recorrerCarga<false>(asignador, ops, r);
+    r.segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    r.operacionesPorSegundo = r.segundos > 0 ? ops.size() / r.segundos : 0.0;
+    recorrerCarga<true>(muestreo, ops, r);
+    r.fallidas = asignador.fallidas;
+    r.fragmentacionInterna = asignador.fragmentacionInterna();
+    r.fragmentacionExterna = asignador.fragmentacionExterna();
+    r.huellaPico = asignador.huellaPico;
+    return r;
+}
+
+// Memoria física simulada por defecto y unidad mínima del buddy usado como asignador general
+const uint64_t MEMORIA_FISICA_DEFECTO = 64ULL << 20;
+const uint64_t MIN_BLOQUE_BUDDY = 32;
+
+// Ejecuta la misma carga sobre el buddy y el slab
+vector<ResultadoAsignador> compararAsignadores(const vector<OperacionMemoria>& ops, uint64_t memoria) {
+    vector<ResultadoAsignador> resultados;
+    {
+        AsignadorBuddy buddy(memoria, MIN_BLOQUE_BUDDY), muestreo(memoria, MIN_BLOQUE_BUDDY);
+        resultados.push_back(ejecutarAsignador(buddy, muestreo, ops));
+    }
+    AsignadorSlab slab(memoria), muestreo(memoria);
+    resultados.push_back(ejecutarAsignador(slab, muestreo, ops));
+    return resultados;
+}
+
+void mostrarResultadosAsignadores(const vector<ResultadoAsignador>& resultados) {
+    cout << "\nAsignador\tOperaciones\tFallidas\tOps/s\t\tReserva p50/p99 (ns)\tLiberación p50/p99 (ns)\t"
+            "Frag. interna\tFrag. externa\tHuella pico\n";
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        const ResultadoAsignador& r = resultados[i];
+        cout << r.nombre << "\t\t" << r.operaciones << "\t\t" << r.fallidas << "\t\t" << r.operacionesPorSegundo << "\t"
+             << r.latenciaReserva.percentil(0.50) << " / " << r.latenciaReserva.percentil(0.99) << "\t\t"
+             << r.latenciaLiberacion.percentil(0.50) << " / " << r.latenciaLiberacion.percentil(0.99) << "\t\t\t"
+             << 100.0 * r.fragmentacionInterna << " %\t" << 100.0 * r.fragmentacionExterna << " %\t"
+             << tamLegible(r.huellaPico) << "\n";
+    }
+}
+
+// Pide la carga (generada o desde archivo) y compara los asignadores
+void simularAsignadores() {
+    int opcion;
+    vector<OperacionMemoria> ops;
+    cout << "Carga (1 = generada, 2 = traza en archivo): ";
+    cin >> opcion;
+    if (opcion == 1) {
+        ConfigCargaMemoria cfg = {1000000, 42, 16, 8192, 20000};
+        cout << "Operaciones, semilla, tamaño mínimo y máximo, bloques vivos máximos: ";
+        cin >> cfg.operaciones >> cfg.semilla >> cfg.tamMin >> cfg.tamMax >> cfg.vivosMax;
+        if (cfg.tamMin < 1 || cfg.tamMax < cfg.tamMin || cfg.vivosMax < 1) {
+            cout << "Configuración inválida.\n";
+            return;
+        }
+        ops = generarCargaMemoria(cfg);
+    } else {
+        string ruta;
+        cout << "Ruta de la traza (a id bytes / f id): ";
+        cin >> ruta;
+        if (!cargarTrazaAsignacion(ruta, ops)) {
+            cout << "No se pudo leer la traza " << ruta << ".\n";
+            return;
+        }
+    }
+    cout << "\nMemoria física: " << tamLegible(MEMORIA_FISICA_DEFECTO) << ", " << ops.size() << " operaciones\n";
+    mostrarResultadosAsignadores(compararAsignadores(ops, MEMORIA_FISICA_DEFECTO));
+}
+
+// ==== Productor-Consumidor ====
+
+// Recursos compartidos
+mutex mtx;                         // Mutex para proteger el acceso concurrente al buffer
+condition_variable cv;            // Condición para sincronizar productor y consumidor
+queue<int> buffer;                // Buffer compartido (cola de enteros)
+const int BUFFER_SIZE = 5;        // Tamaño máximo del buffer
+bool terminado = false;           // Señal para indicar que el productor ha terminado
+
+// Anota en la línea de tiempo la espera por el mutex (y la condición) y el tiempo que se retuvo
+void trazarMutex(int pidTraza, int tid, double pide, double obtiene) {
+    if (pidTraza < 0) return;
+    trazaChrome.intervalo(pidTraza, tid, "Espera mutex", "espera", pide, obtiene - pide);
+    trazaChrome.intervalo(pidTraza, tid, "Retiene mutex", "retiene", obtiene, trazaChrome.ahoraUs() - obtiene);
+}
+
+/**
+ * Función del productor.
+ * Inserta 10 elementos en el buffer, esperando si el buffer está lleno.
+ */
+void productor(int pidTraza) {
+    for (int i = 1; i <= 10; ++i) {
+        double pide = trazaChrome.ahoraUs();
+        unique_lock<mutex> lock(mtx);
+
+        // Esperar mientras el buffer esté lleno
+        cv.wait(lock, [] { return buffer.size() < BUFFER_SIZE; });
+        double obtiene = trazaChrome.ahoraUs();
+
+        buffer.push(i);
+        if (registrando(REGISTRO_EVENTOS)) registro.anotar(REG_PRODUCE, i);
+
+        cv.notify_all();  // Notificar al consumidor que hay datos
+        lock.unlock();
+        trazarMutex(pidTraza, 0, pide, obtiene);
+    }
+
+    // Indicar que se terminó de producir
+    lock_guard<mutex> lock(mtx);
+    terminado = true;
+    cv.notify_all();
+}
+
+/**
+ * Función del consumidor.
+ * Consume elementos del buffer hasta que el productor haya terminado y el buffer esté vacío.
+ * Tanto el buffer como la bandera terminado se consultan siempre con el mutex tomado.
+ */
+void consumidor(int pidTraza) {
+    unique_lock<mutex> lock(mtx);
+    while (true) {
+        // Esperar hasta que haya elementos o el productor haya terminado; el mutex se suelta
+        // durante la espera, así que cada vuelta es una espera y una retención nuevas
+        double pide = trazaChrome.ahoraUs();
+        cv.wait(lock, [] { return !buffer.empty() || terminado; });
+        if (buffer.empty()) break;  // Terminado y sin elementos pendientes
+        double obtiene = trazaChrome.ahoraUs();
+
+        // Consumir todos los elementos disponibles
+        while (!buffer.empty()) {
+            if (registrando(REGISTRO_EVENTOS)) registro.anotar(REG_CONSUME, buffer.front());
+            buffer.pop();
+        }
+
+        cv.notify_all();  // Notificar al productor que hay espacio
+        trazarMutex(pidTraza, 1, pide, obtiene);
+    }
+}
+
+/**
+ * Lanza los hilos de productor y consumidor, y espera a que terminen.
+ */
+void simularProductorConsumidor() {
+    cout << "\nSimulando Productor-Consumidor...\n";
+    terminado = false;  // Permite repetir la simulación
+    int pidTraza = -1;
+    if (trazaChrome.activa()) {
+        pidTraza = trazaChrome.nuevoProceso("Productor-Consumidor");
+        trazaChrome.nombrarPista(pidTraza, 0, "Productor");
+        trazaChrome.nombrarPista(pidTraza, 1, "Consumidor");
+    }
+    thread prod(productor, pidTraza), cons(consumidor, pidTraza);
+    prod.join();  // Esperar a que el productor termine
+    cons.join();  // Esperar a que el consumidor termine
+    registro.vaciar();
+}
+
+// ---- Buffers circulares sin mutex ----
+
+// Tamaño de línea de caché usado para separar los índices que escriben hilos distintos
+const size_t LINEA_CACHE = 64;
+
+// Menor potencia de dos mayor o igual que n
+size_t potenciaDeDos(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+/**
+ * Buffer circular acotado para un solo productor y un solo consumidor, sin bloqueos.
+ * Cada índice lo escribe un único hilo; el otro solo lo lee con semántica acquire/release.
+ * Las operaciones por lote publican muchos elementos con una sola escritura atómica.
+ */
+template <typename T>
+class AnilloSPSC {
+public:
+    explicit AnilloSPSC(size_t capacidad)
+        : datos(potenciaDeDos(capacidad)), mascara(datos.size() - 1), capacidad(capacidad), cabeza(0), cola(0) {}
+
+    // Inserta hasta n elementos; devuelve cuántos cupieron
+    size_t ponerLote(const T* v, size_t n) {
+        size_t c = cola.load(memory_order_relaxed);
+        size_t libres = capacidad - (c - cabeza.load(memory_order_acquire));
+        n = min(n, libres);
+        for (size_t i = 0; i < n; ++i) datos[(c + i) & mascara] = v[i];
+        cola.store(c + n, memory_order_release);
+        return n;
+    }
+
+    // Extrae hasta n elementos; devuelve cuántos había
+    size_t sacarLote(T* v, size_t n) {
+        size_t h = cabeza.load(memory_order_relaxed);
+        size_t disponibles = cola.load(memory_order_acquire) - h;
+        n = min(n, disponibles);
+        for (size_t i = 0; i < n; ++i) v[i] = datos[(h + i) & mascara];
+        cabeza.store(h + n, memory_order_release);
+        return n;
+    }
+
+    bool poner(const T& x) { return ponerLote(&x, 1) == 1; }
+    bool sacar(T& x) { return sacarLote(&x, 1) == 1; }
+
+private:
+    vector<T> datos;
+    size_t mascara;
+    size_t capacidad;                        // Límite real de elementos (BUFFER_SIZE)
+    alignas(LINEA_CACHE) atomic<size_t> cabeza;  // Próxima posición a leer (solo el consumidor)
+    alignas(LINEA_CACHE) atomic<size_t> cola;    // Próxima posición a escribir (solo el productor)
+};
+
+/**
+ * Buffer circular acotado para varios productores y consumidores (cola de Vyukov).
+ * Cada celda tiene un número de secuencia que indica si está libre o llena para la vuelta
+ * actual, así que productores y consumidores solo compiten con un CAS sobre su índice.
+ * La capacidad se redondea a potencia de dos.
+ */
+template <typename T>
+class AnilloMPMC {
+public:
+    explicit AnilloMPMC(size_t capacidad)
+        : celdas(potenciaDeDos(max<size_t>(capacidad, 2))), mascara(celdas.size() - 1), cola(0), cabeza(0) {
+        for (size_t i = 0; i < celdas.size(); ++i) celdas[i].secuencia.store(i, memory_order_relaxed);
+    }
+
+    size_t capacidad() const { return celdas.size(); }
+
+    bool poner(const T& x) {
+        size_t pos = cola.load(memory_order_relaxed);
+        for (;;) {
+            Celda& c = celdas[pos & mascara];
+            size_t sec = c.secuencia.load(memory_order_acquire);
+            intptr_t dif = (intptr_t)sec - (intptr_t)pos;
+            if (dif == 0) {
+                if (cola.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    c.dato = x;
+                    c.secuencia.store(pos + 1, memory_order_release);
+                    return true;
+                }
+            } else if (dif < 0) {
+                return false;  // Lleno
+            } else {
+                pos = cola.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    bool sacar(T& x) {
+        size_t pos = cabeza.load(memory_order_relaxed);
+        for (;;) {
+            Celda& c = celdas[pos & mascara];
+            size_t sec = c.secuencia.load(memory_order_acquire);
+            intptr_t dif = (intptr_t)sec - (intptr_t)(pos + 1);
+            if (dif == 0) {
+                if (cabeza.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    x = c.dato;
+                    c.secuencia.store(pos + mascara + 1, memory_order_release);
+                    return true;
+                }
+            } else if (dif < 0) {
+                return false;  // Vacío
+            } else {
+                pos = cabeza.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    // Los lotes se resuelven celda por celda: cada una sigue necesitando su propio CAS
+    size_t ponerLote(const T* v, size_t n) {
+        size_t i = 0;
+        while (i < n && poner(v[i])) ++i;
+        return i;
+    }
+
+    size_t sacarLote(T* v, size_t n) {
+        size_t i = 0;
+        while (i < n && sacar(v[i])) ++i;
+        return i;
+    }
+
+private:
+    struct Celda {
+        atomic<size_t> secuencia;
+        T dato;
+    };
+
+    vector<Celda> celdas;
+    size_t mascara;
+    alignas(LINEA_CACHE) atomic<size_t> cola;    // Próxima posición a escribir
+    alignas(LINEA_CACHE) atomic<size_t> cabeza;  // Próxima posición a leer
+};
+
+/**
+ * Buffer con mutex y variable de condición, igual que el de la simulación original
+ * (notify_all en cada operación), para compararlo con las versiones sin bloqueo.
+ */
+class BufferMutex {
+public:
+    explicit BufferMutex(size_t capacidad) : capacidad(capacidad) {}
+
+    size_t ponerLote(const uint64_t* v, size_t n) {
+        unique_lock<mutex> lock(m);
+        c.wait(lock, [this] { return datos.size() < capacidad; });
+        n = min(n, capacidad - datos.size());
+        for (size_t i = 0; i < n; ++i) datos.push(v[i]);
+        c.notify_all();
+        return n;
+    }
+
+    // Espera hasta que haya datos o se cierre el buffer; devuelve 0 solo al cerrarse vacío
+    size_t sacarLote(uint64_t* v, size_t n) {
+        unique_lock<mutex> lock(m);
+        c.wait(lock, [this] { return !datos.empty() || cerrado; });
+        n = min(n, datos.size());
+        for (size_t i = 0; i < n; ++i) {
+            v[i] = datos.front();
+            datos.pop();
+        }
+        c.notify_all();
+        return n;
+    }
+
+    void cerrar() {
+        lock_guard<mutex> lock(m);
+        cerrado = true;
+        c.notify_all();
+    }
+
+private:
+    mutex m;
+    condition_variable c;
+    queue<uint64_t> datos;
+    size_t capacidad;
+    bool cerrado = false;
+};
+
+// ---- Benchmark de buffers ----
+
+struct ConfigBenchmarkBuffer {
+    int productores;
+    int consumidores;
+    size_t tamBuffer;       // Capacidad del buffer (BUFFER_SIZE)
+    size_t items;           // Elementos totales a transferir
+    size_t lote;            // Elementos por operación de poner/sacar
+};
+
+struct ResultadoBenchmarkBuffer {
+    string modo;
+    double segundos;
+    double itemsPorSegundo;
+    double latenciaP50, latenciaP90, latenciaP99, latenciaP999;  // Microsegundos
+};
+
+// Marca de tiempo en nanosegundos que viaja dentro de cada elemento
+inline uint64_t ahoraNs() {
+    return (uint64_t)chrono::duration_cast<chrono::nanoseconds>(
+        chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Percentil q (0..1) de un vector de latencias; lo reordena parcialmente
+double percentil(vector<uint64_t>& v, double q) {
+    if (v.empty()) return 0.0;
+    size_t k = (size_t)(q * (v.size() - 1));
+    nth_element(v.begin(), v.begin() + k, v.end());
+    return v[k] / 1000.0;
+}
+
+/**
+ * Ejecuta productores y consumidores sobre un buffer con la interfaz ponerLote/sacarLote.
+ * Cada elemento lleva la hora en que se produjo y el consumidor registra su latencia.
+ * Con cerrarAlTerminar, los consumidores esperan en el buffer y se despiertan con cerrar().
+ */
+template <typename Buffer>
+ResultadoBenchmarkBuffer medirBuffer(const string& modo, Buffer& buf, const ConfigBenchmarkBuffer& cfg) {
+    atomic<size_t> consumidos(0);
+    vector<vector<uint64_t> > latencias(cfg.consumidores);
+
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    vector<thread> hilos;
+    for (int p = 0; p < cfg.productores; ++p) {
+        size_t cuota = cfg.items / cfg.productores + (p < (int)(cfg.items % cfg.productores) ? 1 : 0);
+        hilos.emplace_back([&buf, &cfg, cuota] {
+            vector<uint64_t> lote(cfg.lote);
+            size_t enviados = 0;
+            while (enviados < cuota) {
+                size_t n = min(cfg.lote, cuota - enviados);
+                uint64_t t = ahoraNs();
+                for (size_t i = 0; i < n; ++i) lote[i] = t;
+                size_t hecho = 0;
+                while (hecho < n) {
+                    size_t k = buf.ponerLote(&lote[hecho], n - hecho);
+                    if (k == 0) this_thread::yield();  // Lleno
+                    hecho += k;
+                }
+                enviados += n;
+            }
+        });
+    }
+    for (int c = 0; c < cfg.consumidores; ++c) {
+        vector<uint64_t>& lat = latencias[c];
+        lat.reserve(cfg.items / cfg.consumidores + 1);
+        hilos.emplace_back([&buf, &cfg, &consumidos, &lat] {
+            vector<uint64_t> lote(cfg.lote);
+            while (consumidos.load(memory_order_relaxed) < cfg.items) {
+                size_t n = buf.sacarLote(&lote[0], cfg.lote);
+                if (n == 0) {
+                    this_thread::yield();  // Vacío (o cerrado)
+                    continue;
+                }
+                uint64_t t = ahoraNs();
+                for (size_t i = 0; i < n; ++i) lat.push_back(t - lote[i]);
+                consumidos.fetch_add(n, memory_order_relaxed);
+            }
+        });
+    }
+
+    for (int p = 0; p < cfg.productores; ++p) hilos[p].join();
+    terminarBuffer(buf);
+    for (size_t i = cfg.productores; i < hilos.size(); ++i) hilos[i].join();
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    vector<uint64_t> todas;
+    todas.reserve(cfg.items);
+    for (size_t c = 0; c < latencias.size(); ++c) todas.insert(todas.end(), latencias[c].begin(), latencias[c].end());
+
+    ResultadoBenchmarkBuffer r;
+    r.modo = modo;
+    r.segundos = segundos;
+    r.itemsPorSegundo = segundos > 0 ? cfg.items / segundos : 0.0;
+    r.latenciaP50 = percentil(todas, 0.50);
+    r.latenciaP90 = percentil(todas, 0.90);
+    r.latenciaP99 = percentil(todas, 0.99);
+    r.latenciaP999 = percentil(todas, 0.999);
+    return r;
+}
+
+// Al terminar los productores, el buffer con mutex despierta a los consumidores bloqueados
+void terminarBuffer(BufferMutex& b) { b.cerrar(); }
+template <typename T> void terminarBuffer(AnilloSPSC<T>&) {}
+template <typename T> void terminarBuffer(AnilloMPMC<T>&) {}
+
+// Compara el buffer con mutex/cv contra los anillos sin bloqueos con la misma configuración
+vector<ResultadoBenchmarkBuffer> benchmarkBuffers(const ConfigBenchmarkBuffer& cfg) {
+    vector<ResultadoBenchmarkBuffer> resultados;
+    {
+        BufferMutex b(cfg.tamBuffer);
+        resultados.push_back(medirBuffer("mutex/cv", b, cfg));
+    }
+    if (cfg.productores == 1 && cfg.consumidores == 1) {
+        AnilloSPSC<uint64_t> b(cfg.tamBuffer);
+        resultados.push_back(medirBuffer("SPSC", b, cfg));
+    }
+    {
+        AnilloMPMC<uint64_t> b(cfg.tamBuffer);
+        resultados.push_back(medirBuffer("MPMC", b, cfg));
+    }
+    return resultados;
+}
+
+void mostrarBenchmarkBuffers(const ConfigBenchmarkBuffer& cfg, const vector<ResultadoBenchmarkBuffer>& resultados) {
+    cout << "\nProductores: " << cfg.productores << ", consumidores: " << cfg.consumidores
+         << ", buffer: " << cfg.tamBuffer << ", elementos: " << cfg.items << ", lote: " << cfg.lote << "\n";
+    cout << "Modo\t\tElementos/s\tp50 (us)\tp90 (us)\tp99 (us)\tp99.9 (us)\n";
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        const ResultadoBenchmarkBuffer& r = resultados[i];
+        cout << r.modo << "\t" << (r.modo.size() < 8 ? "\t" : "") << (long long)r.itemsPorSegundo << "\t"
+             << r.latenciaP50 << "\t\t" << r.latenciaP90 << "\t\t" << r.latenciaP99 << "\t\t" << r.latenciaP999 << "\n";
+    }
+}
+
+// Pide la configuración por consola y ejecuta el benchmark
+void benchmarkProductorConsumidor() {
+    ConfigBenchmarkBuffer cfg;
+    cout << "Productores: ";
+    cin >> cfg.productores;
+    cout << "Consumidores: ";
+    cin >> cfg.consumidores;
+    cout << "Tamaño del buffer: ";
+    cin >> cfg.tamBuffer;
+    cout << "Elementos a transferir: ";
+    cin >> cfg.items;
+    cout << "Tamaño de lote: ";
+    cin >> cfg.lote;
+    if (cfg.productores < 1 || cfg.consumidores < 1 || cfg.tamBuffer < 1 || cfg.lote < 1) {
+        cout << "Configuración inválida.\n";
+        return;
+    }
+    mostrarBenchmarkBuffers(cfg, benchmarkBuffers(cfg));
+}
+
+/**
+ * Submenú del productor-consumidor: demostración original o benchmark de buffers.
+ */
+void menuProductorConsumidor() {
+    int opcion;
+    do {
+        cout << "\n=== Productor-Consumidor ===\n";
+        cout << "1. Simulación (mutex y variable de condición)\n";
+        cout << "2. Benchmark mutex/cv vs. buffers sin bloqueo\n";
+        cout << "3. Regresar\n";
+        cout << "Seleccione opción: ";
+        cin >> opcion;
+
+        switch (opcion) {
+            case 1:
+                simularProductorConsumidor();
+                break;
+            case 2:
+                benchmarkProductorConsumidor();
+                break;
+            case 3:
+                break;  // Regresar al menú principal
+            default:
+                cout << "Opción inválida.\n";
+        }
+    } while (opcion != 3);
+}
+
+
+
+
+// ==== Ejecución real de procesos ====
+// En lugar de avanzar un reloj virtual, cada proceso ejecuta trabajo de CPU real: una unidad de
+// ráfaga equivale a unidadUs microsegundos de cálculo. Un pool fijo de hilos toma los procesos
+// de una cola de listos compartida ordenada por la política. Las tareas son cooperativas: al
+// agotar su rebanada (el quantum en Round Robin) vuelven a la cola y el hilo elige la siguiente.
+// Así se mide el rendimiento, la latencia de despacho y el costo de cada cambio en esta máquina.
+
+struct ConfigEjecucionReal {
+    int hilos;           // Tamaño del pool de trabajadores
+    long long unidadUs;  // Microsegundos de CPU por unidad de ráfaga
+};
+
+struct ResultadoEjecucionReal {
+    double segundos;
+    double procesosPorSegundo;
+    double unidadesPorSegundo;
+    long long despachos;
+    double latenciaP50, latenciaP99, latenciaMax;  // Espera en la cola de listos, microsegundos
+    double cambioPromedioUs;  // Tiempo en el planificador por despacho (fuera del trabajo útil)
+    vector<double> finalizacionMs;  // Instante de finalización de cada ranura planificada
+};
+
+// Unidad de trabajo de CPU: un generador xorshift que el compilador no puede eliminar
+inline uint64_t trabajoCPU(uint64_t iteraciones, uint64_t x) {
+    for (uint64_t i = 0; i < iteraciones; ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+    }
+    return x;
+}
+
+atomic<uint64_t> sumideroTrabajo(0);  // Recibe el resultado del cálculo para que no se optimice
+
+// Iteraciones de trabajoCPU que caben en un microsegundo en esta máquina (se mide una vez)
+uint64_t iteracionesPorMicrosegundo() {
+    static uint64_t medidas = 0;
+    if (medidas) return medidas;
+    uint64_t iteraciones = 1 << 16, x = 88172645463325252ULL;
+    uint64_t inicio = ahoraNs();
+    while (ahoraNs() - inicio < 20000000) {  // ~20 ms
+        x = trabajoCPU(iteraciones, x);
+        iteraciones += iteraciones / 2;
+    }
+    double transcurridoUs = (ahoraNs() - inicio) / 1000.0;
+    // Las iteraciones hechas forman una serie geométrica de razón 1.5
+    double total = 2.0 * iteraciones - 2.0 * (1 << 16);
+    sumideroTrabajo += x;
+    medidas = max<uint64_t>(1, (uint64_t)(total / transcurridoUs));
+    return medidas;
+}
+
+/**
+ * Pool de trabajadores que comparten una cola de listos ordenada por la política.
+ * La política y el estado de los procesos solo se tocan con el mutex tomado;
+ * el trabajo de cada rebanada corre sin el mutex.
+ */
+class PlanificadorReal {
+public:
+    PlanificadorReal(const Corrida& corrida, const vector<int>& ranuras, PoliticaPlanificacion& politica,
+                     const ConfigEjecucionReal& cfg)
+        : c(corrida), ranuras(ranuras), politica(politica), cfg(cfg), pendientes(0), despachos(0),
+          tiempoCambios(0), listoDesde(corrida.tabla.size(), 0), finNs(corrida.tabla.size(), 0), pidTraza(-1) {}
+
+    ResultadoEjecucionReal ejecutar() {
+        uint64_t iterPorUnidad = iteracionesPorMicrosegundo() * (uint64_t)cfg.unidadUs;
+        inicio = ahoraNs();
+        long long unidades = 0;
+        for (size_t i = 0; i < ranuras.size(); ++i) {
+            int p = ranuras[i];
+            if (c.estado.remainingTime[p] <= 0) continue;
+            unidades += c.estado.remainingTime[p];
+            c.estado.estado[p] = LISTO;
+            listoDesde[p] = inicio;
+            politica.agregarListo(p, c);
+            ++pendientes;
+        }
+
+        if (trazaChrome.activa()) {
+            pidTraza = trazaChrome.nuevoProceso("Ejecución real " + politica.nombre());
+            for (int i = 0; i < cfg.hilos; ++i) trazaChrome.nombrarPista(pidTraza, i, "Trabajador " + to_string(i + 1));
+        }
+        vector<thread> trabajadores;
+        for (int i = 0; i < cfg.hilos; ++i)
+            trabajadores.emplace_back(&PlanificadorReal::trabajador, this, iterPorUnidad, i);
+        for (auto& t : trabajadores)
+            t.join();
+
+        ResultadoEjecucionReal r;
+        r.segundos = (ahoraNs() - inicio) / 1e9;
+        r.procesosPorSegundo = ranuras.size() / max(r.segundos, 1e-9);
+        r.unidadesPorSegundo = unidades / max(r.segundos, 1e-9);
+        r.despachos = despachos;
+        r.latenciaP50 = percentil(latencias, 0.50);
+        r.latenciaP99 = percentil(latencias, 0.99);
+        r.latenciaMax = percentil(latencias, 1.0);
+        r.cambioPromedioUs = despachos ? tiempoCambios / 1000.0 / despachos : 0.0;
+        for (size_t i = 0; i < ranuras.size(); ++i)
+            r.finalizacionMs.push_back(finNs[ranuras[i]] ? (finNs[ranuras[i]] - inicio) / 1e6 : 0.0);
+        return r;
+    }
+
+private:
+    void trabajador(uint64_t iterPorUnidad, int indice) {
+        uint64_t x = 0x9E3779B97F4A7C15ULL ^ (uint64_t)hash<thread::id>()(this_thread::get_id());
+        unique_lock<mutex> lock(m);
+        uint64_t finAnterior = ahoraNs();  // Fin de la última rebanada de este hilo
+        while (true) {
+            int p;
+            while ((p = politica.siguiente(c)) == -1) {
+                if (pendientes == 0) {
+                    sumideroTrabajo += x;
+                    return;
+                }
+                cv.wait(lock);
+                finAnterior = ahoraNs();  // El tiempo ocioso no cuenta como costo de cambio
+            }
+
+            long long rebanada = politica.rebanada(p, c);
+            c.estado.estado[p] = EJECUTANDO;
+            ++despachos;
+            uint64_t comienzo = ahoraNs();
+            latencias.push_back(comienzo - listoDesde[p]);
+            tiempoCambios += comienzo - finAnterior;
+            if (registrando(REGISTRO_EVENTOS))
+                registro.anotar(REG_DESPACHO, rebanada, 0, c.tabla.nombre(p).c_str());
+            lock.unlock();
+
+            double comienzoUs = trazaChrome.ahoraUs();
+            x = trabajoCPU(iterPorUnidad * (uint64_t)rebanada, x);  // La rebanada de trabajo real
+            if (pidTraza >= 0)
+                trazaChrome.intervalo(pidTraza, indice, c.tabla.nombre(p), "cpu", comienzoUs, trazaChrome.ahoraUs() - comienzoUs);
+
+            uint64_t fin = ahoraNs();
+            lock.lock();
+            finAnterior = fin;
+            c.estado.remainingTime[p] -= rebanada;
+            if (c.estado.remainingTime[p] == 0) {
+                c.estado.estado[p] = TERMINADO;
+                finNs[p] = fin;
+                if (--pendientes == 0) cv.notify_all();  // Los hilos ociosos pueden salir
+            } else {
+                c.estado.estado[p] = LISTO;
+                listoDesde[p] = fin;
+                politica.agregarListo(p, c);  // Punto de cesión: vuelve a la cola de listos
+                cv.notify_one();
+            }
+        }
+    }
+
+    Corrida c;
+    const vector<int>& ranuras;
+    PoliticaPlanificacion& politica;
+    ConfigEjecucionReal cfg;
+    mutex m;
+    condition_variable cv;
+    size_t pendientes;             // Procesos que aún no terminan
+    long long despachos;
+    uint64_t tiempoCambios;        // Suma de los tiempos entre rebanadas consecutivas de un hilo
+    uint64_t inicio;
+    vector<uint64_t> listoDesde;   // Instante en que cada ranura entró a la cola de listos
+    vector<uint64_t> finNs;        // Instante en que terminó cada ranura
+    vector<uint64_t> latencias;    // Latencia de cada despacho
+    int pidTraza;                  // Proceso de la línea de tiempo (-1 sin traza)
+};
+
+void mostrarResultadoEjecucionReal(const vector<int>& ranuras, const ResultadoEjecucionReal& r) {
+    const TablaProcesos& t = tablaProcesos;
+    if (mostrarFilasPorProceso(ranuras.size())) {
+        cout << "\nProceso\tRáfaga\tFinalización (ms)\n";
+        for (size_t i = 0; i < ranuras.size(); ++i)
+            cout << t.nombre(ranuras[i]) << "\t" << t.burstTime[ranuras[i]] << "\t" << r.finalizacionMs[i] << "\n";
+    }
+    cout << "\nTiempo total: " << r.segundos << " s\n";
+    cout << "Rendimiento: " << r.procesosPorSegundo << " procesos/s, " << r.unidadesPorSegundo << " unidades/s\n";
+    cout << "Despachos: " << r.despachos << "\n";
+    cout << "Latencia de despacho p50/p99/máx: " << r.latenciaP50 << " / " << r.latenciaP99 << " / "
+         << r.latenciaMax << " us\n";
+    cout << "Costo promedio por cambio: " << r.cambioPromedioUs << " us\n";
+}
+
+// Ejecuta de verdad los procesos no terminados de la tabla global con RR o SJF
+void ejecutarProcesosReal() {
+    ConfigEjecucionReal cfg = {(int)max(1u, thread::hardware_concurrency()), 1000};
+    int opcion, quantum = 2;
+    cout << "Hilos del pool (" << cfg.hilos << " núcleos disponibles): ";
+    cin >> cfg.hilos;
+    cout << "Política (1 = Round Robin, 2 = SJF): ";
+    cin >> opcion;
+    if (opcion == 1) {
+        cout << "Quantum: ";
+        cin >> quantum;
+    }
+    cout << "Microsegundos de CPU por unidad de ráfaga: ";
+    cin >> cfg.unidadUs;
+    if (cfg.hilos < 1 || (opcion != 1 && opcion != 2) || quantum < 1 || cfg.unidadUs < 1) {
+        cout << "Configuración inválida.\n";
+        return;
+    }
+
+    PoliticaPlanificacion* politica = crearPoliticaPlanificacion(opcion == 1 ? "rr" : "sjf", parametrosPorDefecto(quantum));
+    cout << "\nEjecutando " << politica->nombre() << " con trabajo real en " << cfg.hilos << " hilos\n";
+    vector<int> ranuras = seleccionarRanuras(noTerminado);
+    Corrida c = {tablaProcesos, tablaProcesos.dinamico};
+    ResultadoEjecucionReal r = PlanificadorReal(c, ranuras, *politica, cfg).ejecutar();
+    registro.vaciar();
+    mostrarResultadoEjecucionReal(ranuras, r);
+    terminarTodos(ranuras);
+    delete politica;
+}
+
+
+// ==== Planificación de Disco ====
+// Simula el comportamiento de un disco duro con FCFS, SSTF, SCAN, C-SCAN, LOOK y C-LOOK,
+// midiendo el desplazamiento total y promedio del cabezal para cada algoritmo.
+
+// Cola de solicitudes de disco junto con la posición inicial del cabezal
+struct ColaDisco {
+    vector<int> solicitudes;   // Pistas solicitadas, en orden de llegada
+    int cabeza;                // Posición inicial del cabezal
+    int cilindros;             // Número de cilindros (pistas 0 .. cilindros-1)
+};
+
+// Resultado de atender una cola con un algoritmo
+struct ResultadoDisco {
+    string politica;
+    vector<int> secuencia;     // Orden en que se atienden las solicitudes
+    long long recorrido;       // Cilindros recorridos por el cabezal en total
+};
+
+// Suma el desplazamiento del cabezal al pasar por cada parada desde la posición inicial
+long long desplazamiento(int cabeza, const vector<int>& paradas) {
+    long long total = 0;
+    for (size_t i = 0; i < paradas.size(); ++i) {
+        total += abs(paradas[i] - cabeza);
+        cabeza = paradas[i];
+    }
+    return total;
+}
+
+// --- Algoritmo FCFS (First-Come, First-Served) ---
+// Atiende las solicitudes en el orden en que llegan
+ResultadoDisco discoFCFS(const ColaDisco& cola) {
+    ResultadoDisco r = {"FCFS", cola.solicitudes, 0};
+    r.recorrido = desplazamiento(cola.cabeza, r.secuencia);
+    return r;
+}
+
+// --- Algoritmo SSTF (Shortest Seek Time First) ---
+// Atiende la solicitud más cercana a la posición actual del cabezal. Con las solicitudes
+// ordenadas, las pendientes siempre son las de la izquierda de 'izq' y la derecha de 'der',
+// así que la más cercana se decide comparando solo dos candidatas: O(n log n) en total.
+ResultadoDisco discoSSTF(const ColaDisco& cola, const vector<int>& ordenadas) {
+    ResultadoDisco r = {"SSTF", vector<int>(), 0};
+    r.secuencia.reserve(ordenadas.size());
+
+    long long der = lower_bound(ordenadas.begin(), ordenadas.end(), cola.cabeza) - ordenadas.begin();
+    long long izq = der - 1;
+    int cabeza = cola.cabeza;
+    while (izq >= 0 || der < (long long)ordenadas.size()) {
+        bool tomarIzq;
+        if (izq < 0) tomarIzq = false;
+        else if (der >= (long long)ordenadas.size()) tomarIzq = true;
+        else tomarIzq = cabeza - ordenadas[izq] <= ordenadas[der] - cabeza;  // Empate: hacia abajo
+
+        cabeza = tomarIzq ? ordenadas[izq--] : ordenadas[der++];
+        r.secuencia.push_back(cabeza);
+    }
+    r.recorrido = desplazamiento(cola.cabeza, r.secuencia);
+    return r;
+}
+
+/**
+ * Familia del elevador (el cabezal empieza moviéndose hacia pistas mayores):
+ *  - SCAN: sube hasta el último cilindro y luego baja atendiendo el resto.
+ *  - C-SCAN: sube hasta el último cilindro, vuelve al cilindro 0 y sigue subiendo.
+ *  - LOOK / C-LOOK: igual, pero solo llegan hasta la última solicitud en cada sentido.
+ * El regreso de C-SCAN y C-LOOK se cuenta como desplazamiento del cabezal.
+ */
+ResultadoDisco discoElevador(const ColaDisco& cola, const vector<int>& ordenadas, bool circular, bool hastaElBorde) {
+    ResultadoDisco r = {circular ? (hastaElBorde ? "C-SCAN" : "C-LOOK") : (hastaElBorde ? "SCAN" : "LOOK"),
+                        vector<int>(), 0};
+    r.secuencia.reserve(ordenadas.size());
+
+    size_t corte = lower_bound(ordenadas.begin(), ordenadas.end(), cola.cabeza) - ordenadas.begin();
+    vector<int> paradas;  // Posiciones por las que pasa el cabezal (solicitudes y giros)
+
+    // Subida: solicitudes >= cabeza
+    for (size_t i = corte; i < ordenadas.size(); ++i) r.secuencia.push_back(ordenadas[i]);
+
+    if (corte > 0) {
+        // Punto de giro al terminar la subida
+        int giro = hastaElBorde ? cola.cilindros - 1
+                                : (corte < ordenadas.size() ? ordenadas.back() : cola.cabeza);
+        paradas.push_back(giro);
+
+        if (circular) {
+            // Regreso al inicio y nueva subida por las solicitudes menores
+            paradas.push_back(hastaElBorde ? 0 : ordenadas.front());
+            for (size_t i = 0; i < corte; ++i) r.secuencia.push_back(ordenadas[i]);
+            paradas.push_back(ordenadas[corte - 1]);
+        } else {
+            // Bajada por las solicitudes menores
+            for (size_t i = corte; i-- > 0;) r.secuencia.push_back(ordenadas[i]);
+            paradas.push_back(ordenadas.front());
+        }
+    } else if (!ordenadas.empty()) {
+        // Todas las solicitudes están arriba: basta con subir hasta la última
+        paradas.push_back(ordenadas.back());
+    }
+
+    r.recorrido = desplazamiento(cola.cabeza, paradas);
+    return r;
+}
+
+/**
+ * Posiciones por las que pasa el cabezal al atender la secuencia, incluidos los giros en el
+ * borde de SCAN y C-SCAN (que no son solicitudes); la suma de sus distancias es el recorrido.
+ */
+vector<int> paradasCabezal(const ColaDisco& cola, const ResultadoDisco& r) {
+    bool elevador = r.politica != "FCFS" && r.politica != "SSTF";
+    bool borde = r.politica == "SCAN" || r.politica == "C-SCAN";
+    bool circular = r.politica == "C-SCAN" || r.politica == "C-LOOK";
+    vector<int> paradas;
+    int actual = cola.cabeza;
+    bool subiendo = true;
+    for (size_t i = 0; i < r.secuencia.size(); ++i) {
+        int s = r.secuencia[i];
+        if (elevador && subiendo && s < actual) {
+            if (borde) paradas.push_back(cola.cilindros - 1);
+            if (borde && circular) paradas.push_back(0);
+            subiendo = circular;
+        }
+        paradas.push_back(s);
+        actual = s;
+    }
+    return paradas;
+}
+
+// Línea de tiempo del cabezal: un cilindro recorrido = 1 µs, una pista por algoritmo
+void trazarDisco(const ColaDisco& cola, const vector<ResultadoDisco>& resultados) {
+    int pid = trazaChrome.nuevoProceso("Disco");
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        int tid = (int)i;
+        trazaChrome.nombrarPista(pid, tid, resultados[i].politica);
+        vector<int> paradas = paradasCabezal(cola, resultados[i]);
+        long long instante = 0;
+        int cabeza = cola.cabeza;
+        for (size_t j = 0; j < paradas.size(); ++j) {
+            int distancia = abs(paradas[j] - cabeza);
+            trazaChrome.intervalo(pid, tid, to_string(cabeza) + " -> " + to_string(paradas[j]), "cabezal",
+                                  (double)instante, (double)distancia);
+            instante += distancia;
+            cabeza = paradas[j];
+        }
+    }
+}
+
+// Atiende la cola con todos los algoritmos
+vector<ResultadoDisco> planificarDisco(const ColaDisco& cola) {
+    vector<int> ordenadas = cola.solicitudes;
+    sort(ordenadas.begin(), ordenadas.end());
+
+    vector<ResultadoDisco> resultados;
+    resultados.push_back(discoFCFS(cola));
+    resultados.push_back(discoSSTF(cola, ordenadas));
+    resultados.push_back(discoElevador(cola, ordenadas, false, true));
+    resultados.push_back(discoElevador(cola, ordenadas, true, true));
+    resultados.push_back(discoElevador(cola, ordenadas, false, false));
+    resultados.push_back(discoElevador(cola, ordenadas, true, false));
+    if (trazaChrome.activa()) trazarDisco(cola, resultados);
+    return resultados;
+}
+
+// Las secuencias solo se imprimen para colas pequeñas
+const size_t MAX_SECUENCIA_VISIBLE = 32;
+
+// Muestra la secuencia (si es corta) y el desplazamiento de cada algoritmo
+void mostrarResultadosDisco(const ColaDisco& cola, const vector<ResultadoDisco>& resultados) {
+    size_t n = cola.solicitudes.size();
+    if (n <= MAX_SECUENCIA_VISIBLE) {
+        for (size_t i = 0; i < resultados.size(); ++i) {
+            cout << "\nSimulación " << resultados[i].politica << ":\nSecuencia: ";
+            for (size_t j = 0; j < resultados[i].secuencia.size(); ++j)
+                cout << resultados[i].secuencia[j] << " ";
+        }
+        cout << "\n";
+    }
+
+    cout << "\nCabeza inicial: " << cola.cabeza << ", cilindros: " << cola.cilindros << ", solicitudes: " << n << "\n";
+    cout << "Algoritmo\tRecorrido total\tPromedio por solicitud\n";
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        double promedio = n ? (double)resultados[i].recorrido / n : 0.0;
+        cout << resultados[i].politica << "\t\t" << resultados[i].recorrido << "\t\t" << promedio << "\n";
+    }
+}
+
+/**
+ * Carga una cola de disco desde archivo (texto o binario TRZ1, igual que las trazas de memoria):
+ * el primer valor es la cabeza, el segundo el número de cilindros y el resto las solicitudes.
+ */
+bool cargarColaDisco(const string& ruta, ColaDisco& cola) {
+    LectorTraza lector;
+    if (!lector.abrir(ruta)) return false;
+
+    vector<uint64_t> bloque;
+    vector<uint64_t> valores;
+    while (lector.leerBloque(bloque, TAM_BLOQUE_TRAZA) > 0)
+        valores.insert(valores.end(), bloque.begin(), bloque.end());
+    if (lector.malformada() || valores.size() < 2 || valores[1] == 0) return false;
+
+    cola.cabeza = (int)valores[0];
+    cola.cilindros = (int)valores[1];
+    cola.solicitudes.assign(valores.begin() + 2, valores.end());
+    for (size_t i = 0; i < cola.solicitudes.size(); ++i) {
+        if (cola.solicitudes[i] < 0 || cola.solicitudes[i] >= cola.cilindros) return false;
+    }
+    return cola.cabeza >= 0 && cola.cabeza < cola.cilindros;
+}
+
+// Simula el disco con la cola de ejemplo
+void simularDisco() {
+
+    // Lista de solicitudes de acceso a pistas del disco y posición inicial del cabezal
+    ColaDisco cola;
+    int ejemplo[] = {95, 180, 34, 119, 11, 123, 62, 64};
+    cola.solicitudes.assign(ejemplo, ejemplo + sizeof(ejemplo) / sizeof(int));
+    cola.cabeza = 50;
+    cola.cilindros = 200;
+
+    mostrarResultadosDisco(cola, planificarDisco(cola));
+}
+
+// Simula el disco con una cola cargada desde archivo
+void simularDiscoArchivo(const string& ruta) {
+    ColaDisco cola;
+    if (!cargarColaDisco(ruta, cola)) {
+        cout << "No se pudo cargar la cola de disco " << ruta << ".\n";
+        return;
+    }
+
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    vector<ResultadoDisco> resultados = planificarDisco(cola);
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    mostrarResultadosDisco(cola, resultados);
+    cout << "Tiempo de simulación: " << segundos << " s\n";
+}
+
+// ==== E/S de bloques en tiempo virtual ====
+// A diferencia de la cola estática de arriba, las solicitudes llegan con el tiempo (de un
+// generador o de una traza) y esperan en la cola del elevador mientras el disco atiende otra.
+// Al llegar, una solicitud se fusiona con un lote pendiente si sus bloques son contiguos, así
+// el disco paga una sola búsqueda y una sola espera rotacional por todo el lote. El reloj está
+// en nanosegundos; cada solicitud registra su latencia (llegada hasta fin del lote) en microsegundos.
+
+// Bytes por bloque lógico (LBA)
+const long long TAM_BLOQUE_ES = 4096;
+
+/**
+ * Geometría y tiempos del disco. Los LBA se numeran pista por pista: los primeros
+ * cabezas * sectoresPorPista bloques están en el cilindro 0, los siguientes en el 1, etc.
+ */
+struct GeometriaDisco {
+    int cilindros;
+    int cabezas;
+    int sectoresPorPista;          // Un bloque por sector
+    int rpm;
+    long long busquedaPistaNs;     // Búsqueda entre cilindros vecinos
+    long long busquedaCompletaNs;  // Búsqueda de un extremo al otro
+};
+
+const GeometriaDisco GEOMETRIA_DISCO_DEFECTO = {10000, 4, 500, 7200, 500000, 15000000};
+
+uint64_t bloquesDisco(const GeometriaDisco& g) {
+    return (uint64_t)g.cilindros * g.cabezas * g.sectoresPorPista;
+}
+
+int cilindroDe(const GeometriaDisco& g, uint64_t lba) {
+    return (int)(lba / ((uint64_t)g.cabezas * g.sectoresPorPista));
+}
+
+long long periodoRotacionNs(const GeometriaDisco& g) {
+    return 60000000000LL / g.rpm;
+}
+
+// Curva de búsqueda a + b * sqrt(d): pasa por busquedaPistaNs en d = 1 y por
+// busquedaCompletaNs en d = cilindros - 1 (arranque y frenado dominan las distancias cortas)
+long long tiempoBusqueda(const GeometriaDisco& g, int distancia) {
+    if (distancia <= 0) return 0;
+    double b = (g.busquedaCompletaNs - g.busquedaPistaNs) / (sqrt((double)g.cilindros - 1) - 1.0);
+    return g.busquedaPistaNs + (long long)(b * (sqrt((double)distancia) - 1.0));
+}
+
+// Espera hasta que el sector del LBA pasa bajo el cabezal; el plato gira desde el instante 0
+long long latenciaRotacional(const GeometriaDisco& g, long long instante, uint64_t lba) {
+    long long periodo = periodoRotacionNs(g);
+    double sectorActual = (double)(instante % periodo) * g.sectoresPorPista / periodo;
+    double faltan = (double)(lba % g.sectoresPorPista) - sectorActual;
+    if (faltan < 0) faltan += g.sectoresPorPista;
+    return (long long)(faltan * periodo / g.sectoresPorPista);
+}
+
+bool geometriaDiscoValida(const GeometriaDisco& g) {
+    return g.cilindros >= 3 && g.cabezas >= 1 && g.sectoresPorPista >= 1 && g.rpm >= 1 && g.busquedaPistaNs >= 0 &&
+           g.busquedaCompletaNs > g.busquedaPistaNs;
+}
+
+struct SolicitudES {
+    long long llegada;  // Nanosegundos virtuales
+    uint64_t lba;       // Primer bloque
+    int bloques;
+};
+
+/**
+ * Carga de E/S sintética: llegadas de Poisson con 'tasa' solicitudes por segundo. Con
+ * probabilidad 'secuencialPct' la solicitud continúa uno de los 'flujos' secuenciales (como
+ * varios procesos leyendo archivos a la vez); si no, cae en un LBA aleatorio del disco.
+ */
+struct ConfigCargaES {
+    long long solicitudes;
+    uint64_t semilla;
+    double tasa;
+    int bloquesMin, bloquesMax;
+    int flujos;
+    int secuencialPct;
+};
+
+vector<SolicitudES> generarCargaES(const ConfigCargaES& cfg, const GeometriaDisco& g) {
+    mt19937_64 rng(cfg.semilla);
+    uniform_real_distribution<double> uniforme(0.0, 1.0);
+    uint64_t total = bloquesDisco(g);
+    vector<uint64_t> cursores(max(cfg.flujos, 1));
+    for (size_t i = 0; i < cursores.size(); ++i) cursores[i] = rng() % total;
+
+    vector<SolicitudES> solicitudes;
+    solicitudes.reserve(cfg.solicitudes);
+    double reloj = 0.0;
+    for (long long i = 0; i < cfg.solicitudes; ++i) {
+        double u = uniforme(rng);
+        reloj += -log(1.0 - u) * 1e9 / cfg.tasa;
+        int bloques = cfg.bloquesMin + (int)(rng() % (uint64_t)(cfg.bloquesMax - cfg.bloquesMin + 1));
+
+        uint64_t lba;
+        if (cfg.flujos > 0 && (int)(rng() % 100) < cfg.secuencialPct) {
+            uint64_t& cursor = cursores[rng() % cursores.size()];
+            if (cursor + bloques > total) cursor = 0;  // El flujo llegó al final del disco
+            lba = cursor;
+            cursor += bloques;
+        } else {
+            lba = rng() % (total - bloques + 1);
+        }
+        SolicitudES s = {(long long)reloj, lba, bloques};
+        solicitudes.push_back(s);
+    }
+    return solicitudes;
+}
+
+/**
+ * Carga una traza de E/S (texto o binario TRZ1): ternas de llegada en microsegundos, primer
+ * LBA y cantidad de bloques. Las solicitudes se ordenan por llegada.
+ */
+bool cargarTrazaES(const string& ruta, const GeometriaDisco& g, vector<SolicitudES>& solicitudes) {
+    LectorTraza lector;
+    if (!lector.abrir(ruta)) return false;
+
+    vector<uint64_t> bloque;
+    vector<uint64_t> valores;
+    while (lector.leerBloque(bloque, TAM_BLOQUE_TRAZA) > 0)
+        valores.insert(valores.end(), bloque.begin(), bloque.end());
+    if (lector.malformada() || valores.empty() || valores.size() % 3 != 0) return false;
+
+    solicitudes.clear();
+    solicitudes.reserve(valores.size() / 3);
+    for (size_t i = 0; i < valores.size(); i += 3) {
+        if (valores[i + 2] == 0 || valores[i + 1] + valores[i + 2] > bloquesDisco(g)) return false;
+        SolicitudES s = {(long long)valores[i] * 1000, valores[i + 1], (int)valores[i + 2]};
+        solicitudes.push_back(s);
+    }
+    stable_sort(solicitudes.begin(), solicitudes.end(),
+                [](const SolicitudES& a, const SolicitudES& b) { return a.llegada < b.llegada; });
+    return true;
+}
+
+enum PoliticaES { ES_FCFS, ES_SSTF, ES_SCAN, ES_CSCAN, ES_LOOK, ES_CLOOK };
+
+const char* nombrePoliticaES(PoliticaES p) {
+    switch (p) {
+        case ES_FCFS: return "FCFS";
+        case ES_SSTF: return "SSTF";
+        case ES_SCAN: return "SCAN";
+        case ES_CSCAN: return "C-SCAN";
+        case ES_LOOK: return "LOOK";
+        default: return "C-LOOK";
+    }
+}
+
+struct ResultadoES {
+    PoliticaES politica;
+    bool fusion;
+    long long solicitudes;
+    long long despachos;       // Lotes enviados al disco (menos que solicitudes si hubo fusiones)
+    long long bloques;
+    long long tiempoFinal;     // Nanosegundos virtuales hasta que termina el último lote
+    long long ocupado;         // Tiempo del disco buscando, girando o transfiriendo
+    long long busqueda;        // Parte del tiempo ocupado dedicada a buscar
+    long long rotacion;
+    size_t colaMaxima;         // Lotes pendientes a la vez
+    HistogramaLog latencia;    // Microsegundos por solicitud
+    double segundos;           // Tiempo real de la simulación
+
+    double iops() const { return tiempoFinal > 0 ? solicitudes * 1e9 / tiempoFinal : 0.0; }
+    double mbPorSegundo() const { return tiempoFinal > 0 ? bloques * TAM_BLOQUE_ES * 1e3 / tiempoFinal : 0.0; }
+    double utilizacion() const { return tiempoFinal > 0 ? (double)ocupado / tiempoFinal : 0.0; }
+};
+
+/**
+ * Cola del elevador. Los lotes pendientes se indexan por primer bloque (para elegir según la
+ * posición del cabezal), por bloque siguiente al último (fusión por detrás) y por orden de
+ * creación (FCFS). Las solicitudes de un lote forman una lista enlazada en 'siguienteEnLote'.
+ */
+class ColaElevador {
+public:
+    ColaElevador(size_t solicitudes, int maxBloques)
+        : siguienteEnLote(solicitudes, -1), maxBloques(maxBloques), maximo(0) {}
+
+    // Agrega la solicitud i; con 'fusionar' intenta unirla a un lote contiguo
+    void agregar(int i, const SolicitudES& s, bool fusionar) {
+        if (fusionar) {
+            multimap<uint64_t, int>::iterator atras = porFin.find(s.lba);
+            if (atras != porFin.end() && lotes[atras->second].bloques + s.bloques <= maxBloques) {
+                int l = atras->second;
+                porFin.erase(atras);
+                enlazar(l, i, false);
+                lotes[l].bloques += s.bloques;
+                // La solicitud puede cerrar el hueco con el lote siguiente
+                multimap<uint64_t, int>::iterator adelante = porInicio.find(lotes[l].lba + lotes[l].bloques);
+                if (adelante != porInicio.end() && adelante->second != l &&
+                    lotes[l].bloques + lotes[adelante->second].bloques <= maxBloques) {
+                    int v = adelante->second;
+                    quitar(v);
+                    enlazarLote(l, v);
+                    lotes[l].bloques += lotes[v].bloques;
+                }
+                porFin.insert(make_pair(lotes[l].lba + lotes[l].bloques, l));
+                return;
+            }
+            multimap<uint64_t, int>::iterator adelante = porInicio.find(s.lba + s.bloques);
+            if (adelante != porInicio.end() && lotes[adelante->second].bloques + s.bloques <= maxBloques) {
+                int l = adelante->second;
+                porInicio.erase(adelante);
+                enlazar(l, i, true);
+                lotes[l].lba = s.lba;
+                lotes[l].bloques += s.bloques;
+                porInicio.insert(make_pair(s.lba, l));
+                return;
+            }
+        }
+
+        Lote nuevo = {s.lba, s.bloques, i, i};
+        int l = (int)lotes.size();
+        lotes.push_back(nuevo);
+        porInicio.insert(make_pair(s.lba, l));
+        porFin.insert(make_pair(s.lba + s.bloques, l));
+        porLlegada.insert(l);
+        maximo = max(maximo, porLlegada.size());
+    }
+
+    bool vacia() const { return porLlegada.empty(); }
+    size_t colaMaxima() const { return maximo; }
+
+    // Primer lote creado entre los pendientes
+    int primero() const { return *porLlegada.begin(); }
+
+    // Lote con el menor LBA >= lba, o -1
+    int siguienteDesde(uint64_t lba) const {
+        multimap<uint64_t, int>::const_iterator it = porInicio.lower_bound(lba);
+        return it == porInicio.end() ? -1 : it->second;
+    }
+
+    // Lote con el mayor LBA < lba, o -1
+    int anteriorA(uint64_t lba) const {
+        multimap<uint64_t, int>::const_iterator it = porInicio.lower_bound(lba);
+        return it == porInicio.begin() ? -1 : (--it)->second;
+    }
+
+    uint64_t inicio(int l) const { return lotes[l].lba; }
+    int bloques(int l) const { return lotes[l].bloques; }
+    int primeraSolicitud(int l) const { return lotes[l].primera; }
+    int siguienteSolicitud(int i) const { return siguienteEnLote[i]; }
+
+    // Saca el lote de la cola para enviarlo al disco
+    void quitar(int l) {
+        borrar(porInicio, lotes[l].lba, l);
+        borrar(porFin, lotes[l].lba + lotes[l].bloques, l);
+        porLlegada.erase(l);
+    }
+
+private:
+    struct Lote {
+        uint64_t lba;
+        int bloques;
+        int primera, ultima;  // Extremos de la lista de solicitudes
+    };
+
+    static void borrar(multimap<uint64_t, int>& indice, uint64_t clave, int l) {
+        pair<multimap<uint64_t, int>::iterator, multimap<uint64_t, int>::iterator> r = indice.equal_range(clave);
+        for (multimap<uint64_t, int>::iterator it = r.first; it != r.second; ++it) {
+            if (it->second == l) {
+                indice.erase(it);
+                return;
+            }
+        }
+    }
+
+    void enlazar(int l, int i, bool alFrente) {
+        if (alFrente) {
+            siguienteEnLote[i] = lotes[l].primera;
+            lotes[l].primera = i;
+        } else {
+            siguienteEnLote[lotes[l].ultima] = i;
+            lotes[l].ultima = i;
+        }
+    }
+
+    // Pasa las solicitudes del lote v al final del lote l
+    void enlazarLote(int l, int v) {
+        siguienteEnLote[lotes[l].ultima] = lotes[v].primera;
+        lotes[l].ultima = lotes[v].ultima;
+    }
+
+    vector<Lote> lotes;
+    vector<int> siguienteEnLote;
+    multimap<uint64_t, int> porInicio, porFin;
+    set<int> porLlegada;
+    int maxBloques;
+    size_t maximo;
+};
+
+/**
+ * Atiende las solicitudes con una política y un disco que procesa un lote a la vez. Cada lote
+ * cuesta búsqueda + latencia rotacional + transferencia (más un cambio de pista por cada
+ * cilindro que cruza). SCAN y C-SCAN llevan el cabezal hasta el borde antes de girar; el
+ * regreso de C-SCAN y el salto de C-LOOK se cobran como una búsqueda más.
+ */
+ResultadoES simularES(const vector<SolicitudES>& solicitudes, const GeometriaDisco& g, PoliticaES politica,
+                      bool fusionar, int maxBloques) {
+    chrono::steady_clock::time_point inicioReal = chrono::steady_clock::now();
+    ResultadoES r;
+    r.politica = politica;
+    r.fusion = fusionar;
+    r.solicitudes = (long long)solicitudes.size();
+    r.despachos = r.bloques = r.tiempoFinal = r.ocupado = r.busqueda = r.rotacion = 0;
+
+    ColaElevador cola(solicitudes.size(), maxBloques);
+    long long periodo = periodoRotacionNs(g);
+    long long reloj = 0;
+    uint64_t posicion = 0;  // LBA bajo el cabezal
+    int cabeza = 0;         // Cilindro actual
+    bool subiendo = true;
+    size_t proxima = 0;
+
+    // Mueve el cabezal a un cilindro cobrando la búsqueda
+    auto buscar = [&](int destino) {
+        long long t = tiempoBusqueda(g, abs(destino - cabeza));
+        reloj += t;
+        r.busqueda += t;
+        r.ocupado += t;
+        cabeza = destino;
+    };
+
+    while (proxima < solicitudes.size() || !cola.vacia()) {
+        if (cola.vacia()) reloj = max(reloj, solicitudes[proxima].llegada);
+        while (proxima < solicitudes.size() && solicitudes[proxima].llegada <= reloj) {
+            cola.agregar((int)proxima, solicitudes[proxima], fusionar);
+            ++proxima;
+        }
+
+        int lote = -1;
+        switch (politica) {
+            case ES_FCFS:
+                lote = cola.primero();
+                break;
+            case ES_SSTF: {
+                int arriba = cola.siguienteDesde(posicion), abajo = cola.anteriorA(posicion);
+                if (arriba < 0) lote = abajo;
+                else if (abajo < 0) lote = arriba;
+                else lote = cilindroDe(g, cola.inicio(arriba)) - cabeza <= cabeza - cilindroDe(g, cola.inicio(abajo))
+                                ? arriba : abajo;
+                break;
+            }
+            case ES_SCAN:
+            case ES_LOOK:
+                lote = subiendo ? cola.siguienteDesde(posicion) : cola.anteriorA(posicion);
+                if (lote < 0) {
+                    if (politica == ES_SCAN) {
+                        buscar(subiendo ? g.cilindros - 1 : 0);
+                        posicion = subiendo ? bloquesDisco(g) : 0;
+                    }
+                    subiendo = !subiendo;
+                    lote = subiendo ? cola.siguienteDesde(posicion) : cola.anteriorA(posicion);
+                }
+                break;
+            default:  // C-SCAN y C-LOOK solo atienden subiendo
+                lote = cola.siguienteDesde(posicion);
+                if (lote < 0) {
+                    if (politica == ES_CSCAN) {
+                        buscar(g.cilindros - 1);
+                        buscar(0);
+                    }
+                    posicion = 0;
+                    lote = cola.siguienteDesde(0);
+                }
+        }
+
+        cola.quitar(lote);
+        uint64_t lba = cola.inicio(lote);
+        int bloques = cola.bloques(lote);
+        buscar(cilindroDe(g, lba));
+        long long rotacion = latenciaRotacional(g, reloj, lba);
+        int ultimoCilindro = cilindroDe(g, lba + bloques - 1);
+        long long transferencia = bloques * periodo / g.sectoresPorPista +
+                                  (ultimoCilindro - cabeza) * g.busquedaPistaNs;
+        reloj += rotacion + transferencia;
+        r.rotacion += rotacion;
+        r.ocupado += rotacion + transferencia;
+        cabeza = ultimoCilindro;
+        posicion = lba + bloques;
+
+        ++r.despachos;
+        r.bloques += bloques;
+        for (int i = cola.primeraSolicitud(lote); i >= 0; i = cola.siguienteSolicitud(i))
+            r.latencia.registrar((reloj - solicitudes[i].llegada) / 1000);
+    }
+
+    r.tiempoFinal = reloj;
+    r.colaMaxima = cola.colaMaxima();
+    r.segundos = chrono::duration<double>(chrono::steady_clock::now() - inicioReal).count();
+    return r;
+}
+
+// Corre todas las políticas sin fusión y con fusión de bloques contiguos
+vector<ResultadoES> compararPoliticasES(const vector<SolicitudES>& solicitudes, const GeometriaDisco& g, int maxBloques) {
+    vector<ResultadoES> resultados;
+    for (int f = 0; f < 2; ++f) {
+        for (int p = ES_FCFS; p <= ES_CLOOK; ++p)
+            resultados.push_back(simularES(solicitudes, g, (PoliticaES)p, f == 1, maxBloques));
+    }
+    return resultados;
+}
+
+void mostrarResultadosES(const vector<ResultadoES>& resultados) {
+    cout << "\nAlgoritmo\tFusión\tLotes\tIOPS\tMB/s\tUtiliz.\tLatencia (ms): prom.\tp50\tp99\tp99.9\tmáx.\n";
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        const ResultadoES& r = resultados[i];
+        const HistogramaLog& h = r.latencia;
+        cout << nombrePoliticaES(r.politica) << "\t\t" << (r.fusion ? "sí" : "no") << "\t" << r.despachos << "\t"
+             << (long long)r.iops() << "\t" << (long long)r.mbPorSegundo() << "\t" << (int)(100.0 * r.utilizacion())
+             << " %\t" << h.promedio() / 1000 << "\t\t" << h.percentil(0.50) / 1000.0 << "\t"
+             << h.percentil(0.99) / 1000.0 << "\t" << h.percentil(0.999) / 1000.0 << "\t" << h.mayor() / 1000.0 << "\n";
+    }
+}
+
+// Lote máximo por defecto: 128 bloques (512 KiB)
+const int MAX_BLOQUES_LOTE_ES = 128;
+
+// Pide la carga por consola (o la ruta de una traza) y compara las políticas
+void simularESTemporizada(bool desdeTraza) {
+    GeometriaDisco g = GEOMETRIA_DISCO_DEFECTO;
+    vector<SolicitudES> solicitudes;
+    if (desdeTraza) {
+        string ruta;
+        cout << "Ruta de la traza (llegada en us, LBA, bloques...): ";
+        cin >> ruta;
+        if (!cargarTrazaES(ruta, g, solicitudes)) {
+            cout << "No se pudo cargar la traza de E/S " << ruta << ".\n";
+            return;
+        }
+    } else {
+        ConfigCargaES cfg = {0, 42, 0.0, 1, 32, 8, 70};
+        cout << "Número de solicitudes: ";
+        cin >> cfg.solicitudes;
+        cout << "Solicitudes por segundo: ";
+        cin >> cfg.tasa;
+        cout << "Bloques mínimos y máximos por solicitud (4 KiB c/u): ";
+        cin >> cfg.bloquesMin >> cfg.bloquesMax;
+        cout << "Flujos secuenciales y porcentaje de solicitudes secuenciales: ";
+        cin >> cfg.flujos >> cfg.secuencialPct;
+        cout << "Semilla: ";
+        cin >> cfg.semilla;
+        if (cfg.solicitudes < 1 || cfg.tasa <= 0 || cfg.bloquesMin < 1 || cfg.bloquesMax < cfg.bloquesMin ||
+            cfg.flujos < 0 || cfg.secuencialPct < 0 || cfg.secuencialPct > 100) {
+            cout << "Configuración inválida.\n";
+            return;
+        }
+        solicitudes = generarCargaES(cfg, g);
+    }
+
+    cout << "\nDisco: " << g.cilindros << " cilindros, " << g.rpm << " rpm, "
+         << tamLegible(bloquesDisco(g) * TAM_BLOQUE_ES) << "; lotes de hasta " << MAX_BLOQUES_LOTE_ES
+         << " bloques\n";
+    mostrarResultadosES(compararPoliticasES(solicitudes, g, MAX_BLOQUES_LOTE_ES));
+}
+
+// ==== Cena de los Filósofos ====
+// N filósofos alternan entre pensar y comer M veces. La forma de conseguir los dos tenedores
+// depende de la estrategia elegida para evitar interbloqueos; todas se miden con las mismas
+// métricas: comidas por segundo, justicia (comidas máx./mín. e inanición) y contención.
+
+enum EstrategiaFilosofos { ORDEN_RECURSOS, CAMARERO, CHANDY_MISRA, INTENTO_CON_ESPERA };
+
+const char* nombreEstrategia(EstrategiaFilosofos e) {
+    switch (e) {
+        case ORDEN_RECURSOS: return "Orden de recursos";
+        case CAMARERO: return "Camarero";
+        case CHANDY_MISRA: return "Chandy-Misra";
+        case INTENTO_CON_ESPERA: return "Try-lock + espera";
+    }
+    return "";
+}
+
+struct ConfigFilosofos {
+    int filosofos;                    // Número de filósofos (y tenedores)
+    int comidas;                      // Comidas por filósofo
+    EstrategiaFilosofos estrategia;
+    int piensaUs, comeUs;             // Duración de pensar y comer (microsegundos)
+    bool detalle;                     // Anotar cada acción en el registro de eventos
+};
+
+/**
+ * Mesa con los tenedores y el estado que necesita cada estrategia.
+ * El tenedor izquierdo del filósofo i es el i y el derecho el (i + 1) % N.
+ */
+class MesaFilosofos {
+public:
+    explicit MesaFilosofos(const ConfigFilosofos& cfg)
+        : cfg(cfg), contencion(0), pidTraza(-1), tenedores(cfg.filosofos), enUso(cfg.filosofos, 0),
+          tenedoresCM(cfg.filosofos), comiendo(cfg.filosofos, 0) {
+        // Chandy-Misra: cada tenedor empieza sucio y en manos del vecino de menor índice,
+        // lo que deja el grafo de precedencia sin ciclos
+        for (int k = 0; k < cfg.filosofos; ++k) {
+            tenedoresCM[k].dueno = min(k, (k - 1 + cfg.filosofos) % cfg.filosofos);
+            tenedoresCM[k].sucio = true;
+        }
+    }
+
+    int izquierdo(int id) const { return id; }
+    int derecho(int id) const { return (id + 1) % cfg.filosofos; }
+
+    void tomarTenedores(int id) {
+        switch (cfg.estrategia) {
+            case ORDEN_RECURSOS: tomarEnOrden(id); break;
+            case CAMARERO: tomarConCamarero(id); break;
+            case CHANDY_MISRA: tomarChandyMisra(id); break;
+            case INTENTO_CON_ESPERA: tomarConEspera(id); break;
+        }
+    }
+
+    void soltarTenedores(int id) {
+        int a = izquierdo(id), b = derecho(id);
+        switch (cfg.estrategia) {
+            case ORDEN_RECURSOS:
+            case INTENTO_CON_ESPERA:
+                tenedores[a].unlock();
+                tenedores[b].unlock();
+                break;
+            case CAMARERO: {
+                lock_guard<mutex> lock(mCamarero);
+                enUso[a] = enUso[b] = 0;
+                cvCamarero.notify_all();
+                break;
+            }
+            case CHANDY_MISRA: {
+                // Después de comer ambos tenedores quedan sucios: se entregan al vecino que los pida
+                int primero = min(a, b), segundo = max(a, b);
+                {
+                    lock_guard<mutex> l1(tenedoresCM[primero].m);
+                    lock_guard<mutex> l2(tenedoresCM[segundo].m);
+                    comiendo[id] = 0;
+                    tenedoresCM[a].sucio = tenedoresCM[b].sucio = true;
+                }
+                tenedoresCM[a].cv.notify_all();
+                tenedoresCM[b].cv.notify_all();
+                break;
+            }
+        }
+    }
+
+    const ConfigFilosofos& cfg;
+    atomic<long long> contencion;  // Veces que un filósofo no obtuvo un tenedor a la primera
+    int pidTraza;                  // Proceso de la línea de tiempo (-1 sin traza)
+
+private:
+    // Toma el mutex contando si estaba ocupado
+    void bloquear(mutex& m) {
+        if (m.try_lock()) return;
+        ++contencion;
+        m.lock();
+    }
+
+    // Orden de recursos: siempre primero el tenedor de menor índice (rompe la espera circular)
+    void tomarEnOrden(int id) {
+        int a = izquierdo(id), b = derecho(id);
+        bloquear(tenedores[min(a, b)]);
+        bloquear(tenedores[max(a, b)]);
+    }
+
+    // Camarero: un árbitro entrega los dos tenedores a la vez o ninguno
+    void tomarConCamarero(int id) {
+        int a = izquierdo(id), b = derecho(id);
+        unique_lock<mutex> lock(mCamarero);
+        if (enUso[a] || enUso[b]) {
+            ++contencion;
+            cvCamarero.wait(lock, [this, a, b] { return !enUso[a] && !enUso[b]; });
+        }
+        enUso[a] = enUso[b] = 1;
+    }
+
+    // Chandy-Misra: un tenedor sucio de un vecino que no está comiendo se cede (y se limpia);
+    // uno limpio solo se cede después de que su dueño coma
+    void tomarChandyMisra(int id) {
+        int a = izquierdo(id), b = derecho(id);
+        int primero = min(a, b), segundo = max(a, b);
+        while (true) {
+            obtenerTenedorCM(id, a);
+            obtenerTenedorCM(id, b);
+
+            // Confirmar que ambos siguen siendo propios antes de empezar a comer
+            lock_guard<mutex> l1(tenedoresCM[primero].m);
+            lock_guard<mutex> l2(tenedoresCM[segundo].m);
+            if (tenedoresCM[a].dueno == id && tenedoresCM[b].dueno == id) {
+                comiendo[id] = 1;
+                return;
+            }
+        }
+    }
+
+    void obtenerTenedorCM(int id, int k) {
+        TenedorCM& t = tenedoresCM[k];
+        unique_lock<mutex> lock(t.m);
+        while (t.dueno != id) {
+            if (t.sucio && !comiendo[t.dueno]) {
+                t.dueno = id;
+                t.sucio = false;
+            } else {
+                ++contencion;
+                t.cv.wait(lock);
+            }
+        }
+    }
+
+    // Try-lock con espera exponencial: si el segundo tenedor está ocupado se suelta el primero
+    void tomarConEspera(int id) {
+        int a = izquierdo(id), b = derecho(id);
+        unsigned espera = 1;  // Microsegundos máximos de espera antes del próximo intento
+        static thread_local mt19937 gen(random_device{}());
+        while (true) {
+            bloquear(tenedores[a]);
+            if (tenedores[b].try_lock()) return;
+            tenedores[a].unlock();
+            ++contencion;
+
+            unsigned us = uniform_int_distribution<unsigned>(0, espera)(gen);
+            if (us == 0) this_thread::yield();
+            else this_thread::sleep_for(chrono::microseconds(us));
+            espera = min(espera * 2, 1024u);
+        }
+    }
+
+    struct TenedorCM {
+        mutex m;
+        condition_variable cv;
+        int dueno;     // Filósofo que tiene el tenedor
+        bool sucio;    // Sucio: ya se usó para comer y debe cederse si lo piden
+    };
+
+    vector<mutex> tenedores;          // Orden de recursos y try-lock
+    mutex mCamarero;                  // Camarero
+    condition_variable cvCamarero;
+    vector<char> enUso;
+    vector<TenedorCM> tenedoresCM;    // Chandy-Misra
+    vector<char> comiendo;            // Se modifica con los dos tenedores del filósofo tomados
+};
+
+// Punto de partida común: los hilos esperan aquí hasta que todos fueron creados
+class Largada {
+public:
+    Largada() : abierta(false) {}
+    void esperar() {
+        unique_lock<mutex> lock(m);
+        cv.wait(lock, [this] { return abierta; });
+    }
+    void abrir() {
+        lock_guard<mutex> lock(m);
+        abierta = true;
+        cv.notify_all();
+    }
+private:
+    mutex m;
+    condition_variable cv;
+    bool abierta;
+};
+
+// Métricas de una cena completa
+struct ResultadoFilosofos {
+    double segundos;
+    long long comidasTotales;
+    int comidasMax, comidasMin;       // Comidas de cada filósofo cuando el primero terminó
+    double inanicionMaxMs;            // Mayor tiempo esperando tenedores
+    double inanicionPromedioMs;
+    long long contencion;
+};
+
+/**
+ * Función que simula el comportamiento de un filósofo.
+ * Cada filósofo alterna entre pensar y comer, asegurando el acceso exclusivo a los tenedores adyacentes.
+ */
+void filosofo(int id, MesaFilosofos& mesa, Largada& largada, vector<atomic<int> >& comidas, atomic<bool>& alguienTermino,
+              vector<int>& instantanea, double& inanicionMax, double& inanicionTotal) {
+    const ConfigFilosofos& cfg = mesa.cfg;
+    bool detalle = cfg.detalle && registrando(REGISTRO_EVENTOS);
+    largada.esperar();
+    for (int i = 0; i < cfg.comidas; ++i) {
+        if (detalle) registro.anotar(REG_FILOSOFO_PIENSA, id);
+        if (cfg.piensaUs > 0) this_thread::sleep_for(chrono::microseconds(cfg.piensaUs));
+
+        chrono::steady_clock::time_point hambre = chrono::steady_clock::now();
+        double pide = trazaChrome.ahoraUs();
+        mesa.tomarTenedores(id);
+        double obtiene = trazaChrome.ahoraUs();
+        double espera = chrono::duration<double, milli>(chrono::steady_clock::now() - hambre).count();
+        inanicionMax = max(inanicionMax, espera);
+        inanicionTotal += espera;
+
+        // Sección crítica: el filósofo está comiendo
+        if (detalle) registro.anotar(REG_FILOSOFO_COME, id);
+        if (cfg.comeUs > 0) this_thread::sleep_for(chrono::microseconds(cfg.comeUs));
+        comidas[id].fetch_add(1, memory_order_relaxed);
+
+        mesa.soltarTenedores(id);
+        if (detalle) registro.anotar(REG_FILOSOFO_TERMINA, id);
+        if (mesa.pidTraza >= 0) {
+            trazaChrome.intervalo(mesa.pidTraza, id, "Espera tenedores", "espera", pide, obtiene - pide);
+            trazaChrome.intervalo(mesa.pidTraza, id, "Come", "retiene", obtiene, trazaChrome.ahoraUs() - obtiene);
+        }
+    }
+
+    // El primero en terminar toma una foto de cuántas veces comió cada uno (justicia)
+    if (!alguienTermino.exchange(true)) {
+        for (size_t k = 0; k < comidas.size(); ++k) instantanea[k] = comidas[k].load(memory_order_relaxed);
+    }
+}
+
+/**
+ * Lanza un hilo por cada filósofo y simula la cena completa.
+ */
+ResultadoFilosofos cenaFilosofos(const ConfigFilosofos& cfg) {
+    MesaFilosofos mesa(cfg);
+    if (trazaChrome.activa()) {
+        mesa.pidTraza = trazaChrome.nuevoProceso(string("Filósofos (") + nombreEstrategia(cfg.estrategia) + ")");
+        for (int i = 0; i < cfg.filosofos; ++i) trazaChrome.nombrarPista(mesa.pidTraza, i, "Filósofo " + to_string(i));
+    }
+    vector<atomic<int> > comidas(cfg.filosofos);
+    for (int i = 0; i < cfg.filosofos; ++i) comidas[i].store(0);
+    atomic<bool> alguienTermino(false);
+    vector<int> instantanea(cfg.filosofos, 0);
+    vector<double> inanicionMax(cfg.filosofos, 0.0), inanicionTotal(cfg.filosofos, 0.0);
+
+    Largada largada;
+    vector<thread> filosofos;
+
+    // Crear hilos para cada filósofo; todos empiezan juntos al abrir la largada
+    for (int i = 0; i < cfg.filosofos; ++i)
+        filosofos.emplace_back(filosofo, i, ref(mesa), ref(largada), ref(comidas), ref(alguienTermino), ref(instantanea),
+                               ref(inanicionMax[i]), ref(inanicionTotal[i]));
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    largada.abrir();
+
+    // Esperar que todos terminen
+    for (auto& t : filosofos)
+        t.join();
+    registro.vaciar();
+
+    ResultadoFilosofos r;
+    r.segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    r.comidasTotales = (long long)cfg.filosofos * cfg.comidas;
+    r.comidasMax = *max_element(instantanea.begin(), instantanea.end());
+    r.comidasMin = *min_element(instantanea.begin(), instantanea.end());
+    r.inanicionMaxMs = *max_element(inanicionMax.begin(), inanicionMax.end());
+    double total = 0;
+    for (size_t i = 0; i < inanicionTotal.size(); ++i) total += inanicionTotal[i];
+    r.inanicionPromedioMs = r.comidasTotales ? total / r.comidasTotales : 0.0;
+    r.contencion = mesa.contencion.load();
+    return r;
+}
+
+void mostrarResultadoFilosofos(const ConfigFilosofos& cfg, const ResultadoFilosofos& r) {
+    cout << nombreEstrategia(cfg.estrategia) << ":\t" << r.comidasTotales / max(r.segundos, 1e-9) << " comidas/s"
+         << " | comidas máx/mín: " << r.comidasMax << "/" << r.comidasMin
+         << " | inanición máx: " << r.inanicionMaxMs << " ms (prom. " << r.inanicionPromedioMs << " ms)"
+         << " | contención: " << r.contencion << "\n";
+}
+
+// Demostración original: 5 filósofos, 3 comidas y pausas de medio segundo
+void simularCenaFilosofos() {
+    cout << "\nSimulando Cena de los Filósofos...\n";
+    ConfigFilosofos cfg = {5, 3, ORDEN_RECURSOS, 500000, 500000, true};
+    cenaFilosofos(cfg);
+}
+
+// Ejecuta todas las estrategias con N filósofos y M comidas, sin salida por acción
+void benchmarkFilosofos() {
+    ConfigFilosofos cfg = {5, 1000, ORDEN_RECURSOS, 0, 0, false};
+    cout << "Número de filósofos: ";
+    cin >> cfg.filosofos;
+    cout << "Comidas por filósofo: ";
+    cin >> cfg.comidas;
+    cout << "Tiempo pensando y comiendo (us): ";
+    cin >> cfg.piensaUs >> cfg.comeUs;
+    if (cfg.filosofos < 2 || cfg.comidas < 1 || cfg.piensaUs < 0 || cfg.comeUs < 0) {
+        cout << "Configuración inválida.\n";
+        return;
+    }
+
+    cout << "\n" << cfg.filosofos << " filósofos, " << cfg.comidas << " comidas cada uno\n";
+    EstrategiaFilosofos estrategias[] = {ORDEN_RECURSOS, CAMARERO, CHANDY_MISRA, INTENTO_CON_ESPERA};
+    for (size_t i = 0; i < 4; ++i) {
+        cfg.estrategia = estrategias[i];
+        mostrarResultadoFilosofos(cfg, cenaFilosofos(cfg));
+    }
+}
+
+/**
+ * Submenú de la cena de los filósofos: demostración o benchmark de estrategias.
+ */
+void menuFilosofos() {
+    int opcion;
+    do {
+        cout << "\n=== Cena de los Filósofos ===\n";
+        cout << "1. Simulación (5 filósofos)\n";
+        cout << "2. Benchmark de estrategias\n";
+        cout << "3. Regresar\n";
+        cout << "Seleccione opción: ";
+        cin >> opcion;
+
+        switch (opcion) {
+            case 1:
+                simularCenaFilosofos();
+                break;
+            case 2:
+                benchmarkFilosofos();
+                break;
+            case 3:
+                break;  // Regresar al menú principal
+            default:
+                cout << "Opción inválida.\n";
+        }
+    } while (opcion != 3);
+}
+
+
+
+// ==== Barrido de parámetros ====
+// Repite la planificación con rangos de quantum y de núcleos, y el reemplazo de páginas con un
+// rango de marcos, repartiendo las corridas entre todos los hilos del equipo. La carga (tabla
+// de procesos o traza) se comparte de solo lectura y cada corrida trabaja con su propia copia
+// del estado. Cada resultado se guarda en la posición de su tarea, así que la tabla final sale
+// en el mismo orden sin importar qué hilo termine primero.
+
+// Convierte "1:8", "4:64:4" (desde:hasta[:paso]) o "1,2,4", y combinaciones separadas por comas,
+// en la lista de valores positivos en ese orden. Devuelve una lista vacía si algo no es válido
+vector<long long> leerRango(const string& texto) {
+    vector<long long> valores;
+    size_t inicio = 0;
+    while (inicio <= texto.size()) {
+        size_t coma = texto.find(',', inicio);
+        string parte = texto.substr(inicio, coma == string::npos ? string::npos : coma - inicio);
+        long long desde = 0, hasta = 0, paso = 1;
+        int leidos = sscanf(parte.c_str(), "%lld:%lld:%lld", &desde, &hasta, &paso);
+        if (leidos == 1) hasta = desde;
+        if (leidos < 1 || desde < 1 || hasta < desde || paso < 1 || (hasta - desde) / paso > 100000) return vector<long long>();
+        for (long long v = desde; v <= hasta; v += paso) valores.push_back(v);
+        if (coma == string::npos) break;
+        inicio = coma + 1;
+    }
+    return valores;
+}
+
+// Hilos para un barrido: todos los del equipo, sin pasar del número de tareas
+unsigned hilosBarrido(size_t tareas) {
+    return (unsigned)max<size_t>(1, min<size_t>(tareas, max(1u, thread::hardware_concurrency())));
+}
+
+// Ejecuta tarea(i) para cada i en [0, tareas); los hilos toman el siguiente índice libre
+template <typename Tarea>
+void repartirEnHilos(size_t tareas, unsigned hilos, Tarea tarea) {
+    atomic<size_t> siguiente(0);
+    vector<thread> trabajadores;
+    for (unsigned h = 0; h < hilos; ++h) {
+        trabajadores.push_back(thread([&]() {
+            for (size_t i = siguiente++; i < tareas; i = siguiente++) tarea(i);
+        }));
+    }
+    for (size_t h = 0; h < trabajadores.size(); ++h) trabajadores[h].join();
+}
+
+// Apaga las pausas del modo visual y el registro por evento mientras dura un barrido
+class SilencioBarrido {
+public:
+    SilencioBarrido() : visual(modoVisual), nivel(nivelRegistro) {
+        modoVisual = false;
+        nivelRegistro = REGISTRO_RESUMEN;
+    }
+    ~SilencioBarrido() {
+        modoVisual = visual;
+        nivelRegistro = nivel;
+    }
+
+private:
+    bool visual;
+    NivelRegistro nivel;
+};
+
+struct CorridaBarrido {
+    string politica;
+    long long quantum;
+    long long nucleos;
+    long long fin;                  // Tiempo final de la simulación
+    MetricasPlanificacion metricas;
+};
+
+/**
+ * Planifica las ranuras de 'tabla' con cada combinación de política, quantum y núcleos.
+ * Cada corrida usa los parámetros de 'base' con su propio quantum.
+ * Las políticas con desalojo solo se combinan con un núcleo y sin costos de cambio/migración,
+ * porque el motor multinúcleo no desaloja.
+ */
+vector<CorridaBarrido> barridoPlanificacion(const TablaProcesos& tabla, const vector<int>& ranuras,
+                                            const vector<string>& politicas, const vector<long long>& quantums,
+                                            const vector<long long>& nucleos, const ParametrosPlanificacion& base,
+                                            const ConfigMultinucleo& costos, long long inicio) {
+    vector<CorridaBarrido> corridas;
+    for (size_t p = 0; p < politicas.size(); ++p) {
+        for (size_t q = 0; q < quantums.size(); ++q) {
+            for (size_t n = 0; n < nucleos.size(); ++n) {
+                ParametrosPlanificacion parametros = base;
+                parametros.quantum = (int)quantums[q];
+                PoliticaPlanificacion* prueba = crearPoliticaPlanificacion(politicas[p], parametros);
+                ConfigMultinucleo cfg = {(int)nucleos[n], costos.cambioContexto, costos.migracion};
+                bool valida = prueba && (!usaMotorMultinucleo(cfg) || !prueba->expropiativa());
+                delete prueba;
+                if (!valida) continue;
+                CorridaBarrido c;
+                c.politica = politicas[p];
+                c.quantum = quantums[q];
+                c.nucleos = nucleos[n];
+                c.fin = 0;
+                corridas.push_back(c);
+            }
+        }
+    }
+
+    SilencioBarrido silencio;
+    repartirEnHilos(corridas.size(), hilosBarrido(corridas.size()), [&](size_t i) {
+        CorridaBarrido& r = corridas[i];
+        ParametrosPlanificacion parametros = base;
+        parametros.quantum = (int)r.quantum;
+        vector<PoliticaPlanificacion*> colas;
+        for (long long k = 0; k < r.nucleos; ++k)
+            colas.push_back(crearPoliticaPlanificacion(r.politica, parametros));
+        r.politica = colas[0]->nombre();
+
+        EstadoProcesos estado = tabla.dinamico;  // Copia propia: la tabla se comparte
+        Corrida c = {tabla, estado};
+        ConfigMultinucleo cfg = {(int)r.nucleos, costos.cambioContexto, costos.migracion};
+        if (!usaMotorMultinucleo(cfg)) {
+            SimuladorEventos sim(c, ranuras, *colas[0], inicio);
+            r.fin = sim.ejecutar();
+            r.metricas = sim.resultados();
+        } else {
+            SimuladorMultinucleo sim(c, ranuras, colas, cfg, inicio);
+            r.fin = sim.ejecutar();
+            r.metricas = sim.resultados();
+        }
+        for (size_t k = 0; k < colas.size(); ++k) delete colas[k];
+    });
+    return corridas;
+}
+
+void mostrarBarridoPlanificacion(const vector<CorridaBarrido>& corridas) {
+    if (corridas.empty()) {
+        cout << "No hay combinaciones válidas.\n";
+        return;
+    }
+    size_t mejor = 0;
+    cout << "\nPolítica\tQuantum\tNúcleos\tEspera prom.\tEspera p99\tRetorno p99\tRespuesta p99\t"
+            "Cambios\tUtilización\tFin\n";
+    for (size_t i = 0; i < corridas.size(); ++i) {
+        const CorridaBarrido& c = corridas[i];
+        const MetricasPlanificacion& m = c.metricas;
+        cout << c.politica << "\t" << c.quantum << "\t" << c.nucleos << "\t" << m.espera.promedio() << "\t\t"
+             << m.espera.percentil(0.99) << "\t\t" << m.retorno.percentil(0.99) << "\t\t"
+             << m.respuesta.percentil(0.99) << "\t\t" << m.cambiosContexto << "\t"
+             << 100.0 * m.utilizacion() << " %\t" << c.fin << "\n";
+        if (m.espera.promedio() < corridas[mejor].metricas.espera.promedio()) mejor = i;
+    }
+    cout << "Menor espera promedio: " << corridas[mejor].politica << " con quantum " << corridas[mejor].quantum
+         << " y " << corridas[mejor].nucleos << " núcleo(s)\n";
+}
+
+struct CorridaReemplazo {
+    string politica;
+    size_t marcos;
+    unsigned long long referencias, fallos;
+};
+
+// Recorre la traza (compartida) con cada política de reemplazo y cantidad de marcos
+vector<CorridaReemplazo> barridoReemplazo(const vector<uint64_t>& traza, const vector<long long>& marcos) {
+    vector<CorridaReemplazo> corridas;
+    for (size_t m = 0; m < marcos.size(); ++m) {
+        for (size_t p = 0; p <= NUM_POLITICAS_FLUJO; ++p) {
+            CorridaReemplazo c = {p < NUM_POLITICAS_FLUJO ? POLITICAS_FLUJO[p] : "OPT", (size_t)marcos[m], 0, 0};
+            corridas.push_back(c);
+        }
+    }
+
+    repartirEnHilos(corridas.size(), hilosBarrido(corridas.size()), [&](size_t i) {
+        CorridaReemplazo& r = corridas[i];
+        PoliticaReemplazo* motor = r.politica == "OPT" ? new MotorOPT(r.marcos, traza)
+                                                       : crearMotorReemplazo(r.politica, r.marcos);
+        for (size_t k = 0; k < traza.size(); ++k) motor->referenciar(traza[k]);
+        r.referencias = motor->referencias;
+        r.fallos = motor->fallos;
+        delete motor;
+    });
+    return corridas;
+}
+
+void mostrarBarridoReemplazo(const vector<CorridaReemplazo>& corridas) {
+    cout << "\nPolítica\tMarcos\tReferencias\tFallos\tTasa de fallos\n";
+    for (size_t i = 0; i < corridas.size(); ++i) {
+        const CorridaReemplazo& c = corridas[i];
+        double tasa = c.referencias ? (double)c.fallos / c.referencias : 0.0;
+        cout << c.politica << "\t\t" << c.marcos << "\t" << c.referencias << "\t\t" << c.fallos << "\t"
+             << tasa * 100 << " %\n";
+    }
+}
+
+/**
+ * Barrido interactivo: la planificación usa los procesos no terminados de la tabla global sin
+ * modificarlos, y el reemplazo usa la secuencia de ejemplo o una traza en archivo.
+ */
+void menuBarrido() {
+    int opcion;
+    cout << "\n=== Barrido de parámetros ===\n";
+    cout << "1. Planificación (quantum y núcleos)\n";
+    cout << "2. Reemplazo de páginas (marcos)\n";
+    cout << "Seleccione opción: ";
+    cin >> opcion;
+
+    string texto;
+    chrono::steady_clock::time_point inicio;
+    if (opcion == 1) {
+        string politica, quantums, nucleos;
+        cout << "Política (fcfs, rr, sjf, srtf, mlfq, cfs): ";
+        cin >> politica;
+        cout << "Quantums (ej. 1:8 o 1,2,4): ";
+        cin >> quantums;
+        cout << "Núcleos (ej. 1:4): ";
+        cin >> nucleos;
+        vector<long long> q = leerRango(quantums), n = leerRango(nucleos);
+        vector<int> ranuras = seleccionarRanuras(noTerminado);
+        if (q.empty() || n.empty() || ranuras.empty()) {
+            cout << "Rangos inválidos o no hay procesos sin terminar.\n";
+            return;
+        }
+        ConfigMultinucleo costos = {1, 0, 0};
+        inicio = chrono::steady_clock::now();
+        vector<CorridaBarrido> corridas = barridoPlanificacion(tablaProcesos, ranuras, vector<string>(1, politica), q, n,
+                                                               parametrosPorDefecto(2), costos, tiempoGlobal);
+        mostrarBarridoPlanificacion(corridas);
+        cout << corridas.size() << " corridas en " << hilosBarrido(corridas.size()) << " hilos, "
+             << chrono::duration<double>(chrono::steady_clock::now() - inicio).count() << " s\n";
+    } else if (opcion == 2) {
+        string ruta, marcos;
+        cout << "Ruta de la traza (o \"ejemplo\"): ";
+        cin >> ruta;
+        cout << "Marcos (ej. 1:16): ";
+        cin >> marcos;
+        vector<long long> m = leerRango(marcos);
+        vector<uint64_t> traza = referenciasEjemplo();
+        if (ruta != "ejemplo" && !cargarTraza(ruta, LIMITE_REFERENCIAS_OPT, traza)) {
+            cout << "No se pudo cargar la traza " << ruta << ".\n";
+            return;
+        }
+        if (m.empty()) {
+            cout << "Rango de marcos inválido.\n";
+            return;
+        }
+        inicio = chrono::steady_clock::now();
+        vector<CorridaReemplazo> corridas = barridoReemplazo(traza, m);
+        mostrarBarridoReemplazo(corridas);
+        cout << corridas.size() << " corridas en " << hilosBarrido(corridas.size()) << " hilos, "
+             << chrono::duration<double>(chrono::steady_clock::now() - inicio).count() << " s\n";
+    } else {
+        cout << "Opción inválida.\n";
     }
+}
 
-    // Ejecutar todos los procesos que están en estado LISTO, uno por uno
-    for (auto& p : procesos) {
-        if (p.estado == LISTO) {
-            p.estado = EJECUTANDO;
-            cout << "Ejecutando proceso: " << p.id << "\n";
+// ==== Modo sin interfaz (escenarios) ====
+// Permite ejecutar el simulador sin el menú interactivo, para corridas repetibles en lotes:
+//
+//   simulador --escenario=archivo.txt [--clave=valor ...]
+//
+// El archivo de escenario tiene líneas "clave = valor" (las que empiezan con # se ignoran)
+// y los argumentos --clave=valor tienen prioridad sobre él. Claves reconocidas:
+//   procesos      lista id:ráfaga[@llegada][~nice] separada por comas (puede repetirse)
+//   carga         procesos sintéticos a generar, con semilla, llegadas (poisson, rafagas), tasa,
+//                 tam_rafaga, distribucion (exponencial, bimodal, pareto) y rafaga_media
+//   planificador  lista de políticas: fcfs, rr, sjf, srtf, mlfq, cfs
+//   quantum       quantum de Round Robin y del primer nivel de MLFQ (por defecto 2)
+//   niveles, boost   niveles de MLFQ y periodo del boost de prioridad
+//   latencia, granularidad   latencia objetivo y rebanada mínima de CFS
+//   nucleos, cambio, migracion   núcleos simulados y costos de cambio de contexto y migración
+//   ejecucion     simulada (por defecto) o real; con real se usan también hilos y unidad_us
+//   traza, marcos traza de referencias y lista de marcos para las políticas de reemplazo
+//   paginas       bits de desplazamiento de página (lista); con ella la traza se traduce como
+//                 direcciones virtuales con ancho_direccion, niveles_tabla, tlb_entradas,
+//                 tlb_vias, tlb_reemplazo (lru, fifo, aleatorio), reemplazo (política de marcos)
+//                 y costo_tlb, costo_memoria, costo_fallo (ns)
+//   asignador     traza de reservas ("a id bytes" / "f id") o "generar" (con operaciones, semilla,
+//                 tam_min, tam_max, vivos); memoria_mib fija la memoria física simulada
+//   empleados     spooler de impresión en tiempo virtual, con impresoras, documentos, semilla,
+//                 preparacion_min_ms, preparacion_max_ms, trabajo_min_ms y trabajo_max_ms
+//   disco         cola de disco en archivo, o "ejemplo"
+//   productores, consumidores, buffer, items, lote   benchmark de buffers (si hay items)
+//   filosofos, comidas, piensa_us, come_us            benchmark de filósofos (si hay filosofos)
+//   barrido_quantum, barrido_nucleos, barrido_marcos   rangos (1:8, 4:64:4 o 1,2,4) que se
+//                 comparan en paralelo en lugar de la corrida simple de planificación y memoria
+//   formato       json (por defecto) o csv
+//   salida        archivo de resultados (por defecto la salida estándar)
+//   registro      nivel del registro de eventos: resumen (por defecto), eventos o detalle
+//   registro_archivo  archivo binario donde se guardan los eventos
+// Cada módulo configurado se ejecuta uno tras otro y sus resultados se emiten juntos.
 
-            // Simula tiempo de CPU consumido (medio segundo)
-            this_thread::sleep_for(chrono::milliseconds(500));
+typedef map<string, string> Escenario;
+
+// Quita espacios al inicio y al final
+string recortar(const string& s) {
+    size_t a = s.find_first_not_of(" \t\r\n");
+    if (a == string::npos) return "";
+    size_t b = s.find_last_not_of(" \t\r\n");
+    return s.substr(a, b - a + 1);
+}
 
-            // El proceso termina inmediatamente después de ejecutarse
-            p.remainingTime = 0;
-            p.estado = TERMINADO;
-            cout << "Proceso " << p.id << " terminado.\n";
+// Separa un texto por un carácter, descartando elementos vacíos
+vector<string> separar(const string& texto, char separador) {
+    vector<string> partes;
+    string actual;
+    for (size_t i = 0; i <= texto.size(); ++i) {
+        if (i == texto.size() || texto[i] == separador) {
+            actual = recortar(actual);
+            if (!actual.empty()) partes.push_back(actual);
+            actual.clear();
+        } else {
+            actual += texto[i];
         }
     }
+    return partes;
 }
 
-// ==== Planificación Round Robin ====
-// Simula la planificación de procesos usando el algoritmo Round Robin con quantum fijo
-void ejecutarRoundRobin() {
-
-    // Estructura auxiliar para mantener información adicional por proceso durante la simulación
-    struct ProcesoRR {
-        string id;
-        int arrivalTime;
-        int burstTime;
-        int remainingTime;
-        int completionTime;
-        int turnAroundTime;
-        int waitingTime;
-    };
+// Agrega una clave al escenario; "procesos" se acumula en lugar de reemplazarse
+void asignarClave(Escenario& esc, const string& clave, const string& valor) {
+    if (clave == "procesos" && esc.count(clave)) esc[clave] += "," + valor;
+    else esc[clave] = valor;
+}
 
-    // Crear lista de procesos que aún no han terminado
-    vector<ProcesoRR> rrProcesos;
-    for (const auto& p : procesos) {
-        if (p.estado != TERMINADO) {
-            rrProcesos.push_back({p.id, p.arrivalTime, p.burstTime, p.burstTime});
-        }
+bool cargarEscenario(const string& ruta, Escenario& esc) {
+    ifstream in(ruta.c_str());
+    if (!in) return false;
+    string linea;
+    while (getline(in, linea)) {
+        linea = recortar(linea);
+        if (linea.empty() || linea[0] == '#') continue;
+        size_t igual = linea.find('=');
+        if (igual == string::npos) continue;
+        asignarClave(esc, recortar(linea.substr(0, igual)), recortar(linea.substr(igual + 1)));
     }
+    return true;
+}
 
-    int quantum = 2;                  // Tiempo fijo de CPU por proceso
-    int tiempo = tiempoGlobal;       // Simula el tiempo actual del sistema
-    cout << "\nEjecutando Round Robin con quantum = " << quantum << "\n";
+// Convierte un texto entero completo (sin sobrantes como en "2x" y sin desbordar)
+bool leerEntero(const string& texto, long long& valor) {
+    if (texto.empty()) return false;
+    char* fin;
+    errno = 0;
+    valor = strtoll(texto.c_str(), &fin, 10);
+    return errno == 0 && *fin == '\0';
+}
 
-    // Ejecutar los procesos cíclicamente hasta que todos terminen
-    bool quedaTrabajo;
-    do {
-        quedaTrabajo = false;
-        for (auto& p : rrProcesos) {
-            if (p.remainingTime > 0) {
-                quedaTrabajo = true;
-                int ejecucion = min(quantum, p.remainingTime);
-                cout << "Ejecutando " << p.id << " por " << ejecucion << " unidades de tiempo.\n";
-
-                // Simula el uso de CPU
-                this_thread::sleep_for(chrono::milliseconds(300));
-
-                // Avanza el tiempo del sistema
-                tiempo += ejecucion;
-                p.remainingTime -= ejecucion;
-
-                // Si el proceso ha terminado, se calculan métricas
-                if (p.remainingTime == 0) {
-                    p.completionTime = tiempo;
-                    p.turnAroundTime = p.completionTime - p.arrivalTime;
-                    p.waitingTime = p.turnAroundTime - p.burstTime;
-                }
-            }
-        }
-    } while (quedaTrabajo);  // Repetir hasta que todos los procesos hayan terminado
+// Claves que se leen con valorEntero; se validan antes de ejecutar cualquier módulo
+const char* const CLAVES_ENTERAS[] = {
+    "ancho_direccion", "boost", "buffer", "cambio", "carga", "come_us", "comidas", "consumidores",
+    "costo_fallo", "costo_memoria", "costo_tlb", "documentos", "empleados", "filosofos", "granularidad",
+    "hilos", "impresoras", "io_bloques_max", "io_bloques_min", "io_cilindros", "io_flujos", "io_lote_max",
+    "io_rpm", "io_secuencial", "io_solicitudes", "items", "latencia", "lote", "memoria_mib", "migracion",
+    "niveles", "niveles_tabla", "nucleos", "operaciones", "piensa_us", "preparacion_max_ms",
+    "preparacion_min_ms", "productores", "quantum", "semilla", "tam_max", "tam_min", "tlb_entradas",
+    "tlb_vias", "trabajo_max_ms", "trabajo_min_ms", "unidad_us", "vivos"};
 
-    // Mostrar tabla de resultados
-    int totalWT = 0, totalTAT = 0;
-    cout << "\nProceso\tLlegada\tEjecución\tFinalización\tRetorno\tEspera\n";
-    for (auto& p : rrProcesos) {
-        cout << p.id << "\t" << p.arrivalTime << "\t" << p.burstTime
-             << "\t\t" << p.completionTime << "\t\t" << p.turnAroundTime
-             << "\t" << p.waitingTime << "\n";
-        totalWT += p.waitingTime;
-        totalTAT += p.turnAroundTime;
+// Devuelve false y deja en 'error' la primera clave entera cuyo valor no es un entero válido
+bool validarClavesEnteras(const Escenario& esc, string& error) {
+    for (size_t i = 0; i < sizeof(CLAVES_ENTERAS) / sizeof(CLAVES_ENTERAS[0]); ++i) {
+        Escenario::const_iterator it = esc.find(CLAVES_ENTERAS[i]);
+        long long valor;
+        if (it != esc.end() && !leerEntero(it->second, valor)) {
+            error = "valor entero inválido en " + it->first + ": \"" + it->second + "\"";
+            return false;
+        }
     }
+    return true;
+}
 
-    // Mostrar promedios
-    cout << "\nTiempo promedio de espera: " << (float)totalWT / rrProcesos.size() << " unidades\n";
-    cout << "Tiempo promedio de retorno: " << (float)totalTAT / rrProcesos.size() << " unidades\n";
+long long valorEntero(const Escenario& esc, const string& clave, long long porDefecto) {
+    Escenario::const_iterator it = esc.find(clave);
+    long long valor;
+    return it != esc.end() && leerEntero(it->second, valor) ? valor : porDefecto;
+}
 
-    // Marcar todos los procesos como TERMINADOS en la lista principal
-    for (auto& p : procesos) {
-        if (p.estado != TERMINADO)
-            p.estado = TERMINADO, p.remainingTime = 0;
-    }
+string valorTexto(const Escenario& esc, const string& clave, const string& porDefecto) {
+    Escenario::const_iterator it = esc.find(clave);
+    return it == esc.end() ? porDefecto : it->second;
 }
 
-// ==== Planificación SJF ====
-// Simula la planificación de procesos usando el algoritmo Shortest Job First (sin desalojo)
-void ejecutarSJF() {
+// ---- Resultados legibles por máquina ----
 
-    // Estructura auxiliar para representar un proceso con sus métricas temporales
-    struct ProcesoSJF {
-        string id;
-        int arrivalTime;
-        int burstTime;
-        int completionTime;
-        int turnAroundTime;
-        int waitingTime;
-    };
+// Un resultado: módulo, etiquetas que identifican el caso y métricas numéricas
+struct RegistroResultado {
+    string modulo;
+    vector<pair<string, string> > etiquetas;
+    vector<pair<string, double> > metricas;
 
-    vector<ProcesoSJF> sjfProcesos;
+    RegistroResultado& etiqueta(const string& k, const string& v) { etiquetas.push_back(make_pair(k, v)); return *this; }
+    RegistroResultado& metrica(const string& k, double v) { metricas.push_back(make_pair(k, v)); return *this; }
+};
 
-    // Copiar todos los procesos no terminados a una nueva lista para la simulación
-    for (const auto& p : procesos) {
-        if (p.estado != TERMINADO) {
-            sjfProcesos.push_back({p.id, p.arrivalTime, p.burstTime});
-        }
+/**
+ * Texto de una métrica sin perder precisión: los valores enteros (conteos, tiempos) se escriben
+ * como enteros y el resto con la menor cantidad de dígitos que vuelve a leerse igual.
+ */
+string textoMetrica(double v) {
+    char texto[32];
+    if (v == floor(v) && fabs(v) < 9007199254740992.0) {  // 2^53: enteros exactos en un double
+        snprintf(texto, sizeof(texto), "%lld", (long long)v);
+    } else {
+        snprintf(texto, sizeof(texto), "%.15g", v);
+        if (strtod(texto, nullptr) != v) snprintf(texto, sizeof(texto), "%.17g", v);
     }
+    return texto;
+}
 
-    cout << "\nEjecutando SJF (Shortest Job First)\n";
-
-    // Orden inicial por tiempo de llegada
-    sort(sjfProcesos.begin(), sjfProcesos.end(), [](const ProcesoSJF& a, const ProcesoSJF& b) {
-        return a.arrivalTime < b.arrivalTime;
-    });
+// JSON: {"resultados": [{"modulo": ..., <etiquetas como texto>, <métricas como número>}, ...]}
+void emitirJSON(ostream& out, const vector<RegistroResultado>& registros) {
+    out << "{\"resultados\": [";
+    for (size_t i = 0; i < registros.size(); ++i) {
+        const RegistroResultado& r = registros[i];
+        out << (i ? ",\n  " : "\n  ") << "{\"modulo\": \"" << escaparJSON(r.modulo) << "\"";
+        for (size_t j = 0; j < r.etiquetas.size(); ++j)
+            out << ", \"" << escaparJSON(r.etiquetas[j].first) << "\": \"" << escaparJSON(r.etiquetas[j].second) << "\"";
+        for (size_t j = 0; j < r.metricas.size(); ++j)
+            out << ", \"" << escaparJSON(r.metricas[j].first) << "\": " << textoMetrica(r.metricas[j].second);
+        out << "}";
+    }
+    out << "\n]}\n";
+}
 
-    int tiempo = 0;
+// CSV en formato largo (una métrica por fila), así todas las filas tienen las mismas columnas
+void emitirCSV(ostream& out, const vector<RegistroResultado>& registros) {
+    out << "modulo,caso,metrica,valor\n";
+    for (size_t i = 0; i < registros.size(); ++i) {
+        const RegistroResultado& r = registros[i];
+        string caso;
+        for (size_t j = 0; j < r.etiquetas.size(); ++j)
+            caso += (j ? ";" : "") + r.etiquetas[j].first + "=" + r.etiquetas[j].second;
+        for (size_t j = 0; j < r.metricas.size(); ++j)
+            out << r.modulo << "," << caso << "," << r.metricas[j].first << "," << textoMetrica(r.metricas[j].second) << "\n";
+    }
+}
 
-    // Ejecutar todos los procesos según menor burstTime disponible
-    for (size_t i = 0; i < sjfProcesos.size(); ++i) {
-        // Reordenar desde la posición actual según burstTime (solo los que han llegado)
-        sort(sjfProcesos.begin() + i, sjfProcesos.end(), [](const ProcesoSJF& a, const ProcesoSJF& b) {
-            return a.burstTime < b.burstTime;
-        });
+// ---- Módulos ----
 
-        // Esperar si el proceso aún no ha llegado
-        tiempo = max(tiempo, sjfProcesos[i].arrivalTime);
+// Construye la tabla de procesos del escenario: parte de una instantánea (si se indica), le
+// agrega la lista id:ráfaga[@llegada][~nice] y la carga sintética, y con guardar_instantanea
+// guarda el resultado para repetir la corrida con la misma entrada. 'reloj' queda en el reloj
+// de la instantánea (0 sin ella): la carga sintética llega desde ahí y la simulación parte de él
+bool cargarProcesosEscenario(const Escenario& esc, TablaProcesos& tabla, long long& reloj, string& error) {
+    error = "instantánea, lista de procesos o carga sintética inválida";
+    reloj = 0;
+    if (esc.count("instantanea") && !cargarInstantanea(valorTexto(esc, "instantanea", ""), tabla, reloj)) return false;
 
-        // Calcular métricas de ejecución
-        sjfProcesos[i].completionTime = tiempo + sjfProcesos[i].burstTime;
-        sjfProcesos[i].turnAroundTime = sjfProcesos[i].completionTime - sjfProcesos[i].arrivalTime;
-        sjfProcesos[i].waitingTime = sjfProcesos[i].turnAroundTime - sjfProcesos[i].burstTime;
-        tiempo = sjfProcesos[i].completionTime;
+    vector<string> lista = separar(valorTexto(esc, "procesos", ""), ',');
+    for (size_t i = 0; i < lista.size(); ++i) {
+        size_t dosPuntos = lista[i].find(':');
+        if (dosPuntos == string::npos) return false;
+        string id = lista[i].substr(0, dosPuntos);
+        string resto = lista[i].substr(dosPuntos + 1);
+        size_t tilde = resto.find('~');
+        int nice = tilde == string::npos ? 0 : atoi(resto.substr(tilde + 1).c_str());
+        resto = resto.substr(0, tilde);
+        size_t arroba = resto.find('@');
+        int rafaga = atoi(resto.substr(0, arroba).c_str());
+        int llegada = arroba == string::npos ? 0 : atoi(resto.substr(arroba + 1).c_str());
+        if (!TablaProcesos::idValido(id) || rafaga <= 0 || llegada < 0 || nice < NICE_MIN || nice > NICE_MAX ||
+            tabla.buscar(id) != -1)
+            return false;
+        ProcesoSimulado p = {id, llegada, rafaga, rafaga, NUEVO, nice};
+        tabla.agregar(p);
+    }
 
-        cout << "Ejecutando " << sjfProcesos[i].id << " por " << sjfProcesos[i].burstTime << " unidades.\n";
-        this_thread::sleep_for(chrono::milliseconds(300));  // Simula tiempo de CPU
+    if (esc.count("carga")) {
+        ConfigCarga cfg = {(size_t)valorEntero(esc, "carga", 0), (uint64_t)valorEntero(esc, "semilla", 42), LLEGADAS_POISSON,
+                           atof(valorTexto(esc, "tasa", "0.5").c_str()), atof(valorTexto(esc, "tam_rafaga", "8").c_str()),
+                           RAFAGA_EXPONENCIAL, atof(valorTexto(esc, "rafaga_media", "10").c_str())};
+        string llegadas = valorTexto(esc, "llegadas", "poisson");
+        string distribucion = valorTexto(esc, "distribucion", "exponencial");
+        if (llegadas == "rafagas") cfg.llegadas = LLEGADAS_RAFAGAS;
+        else if (llegadas != "poisson") return false;
+        if (distribucion == "bimodal") cfg.rafagas = RAFAGA_BIMODAL;
+        else if (distribucion == "pareto") cfg.rafagas = RAFAGA_PARETO;
+        else if (distribucion != "exponencial") return false;
+        if (cfg.procesos < 1 || cfg.tasaLlegada <= 0 || cfg.tamRafagaMedio < 1 || cfg.rafagaMedia <= 0) return false;
+        generarCarga(cfg, tabla, reloj);
+    }
+    string destino = valorTexto(esc, "guardar_instantanea", "");
+    if (esc.count("guardar_instantanea") && !guardarInstantanea(destino, tabla, reloj)) {
+        error = "no se pudo escribir la instantánea " + destino;
+        return false;
     }
+    return true;
+}
 
-    // Mostrar resultados
-    int totalWT = 0, totalTAT = 0;
-    cout << "\nProceso\tLlegada\tEjecución\tFinalización\tRetorno\tEspera\n";
-    for (auto& p : sjfProcesos) {
-        cout << p.id << "\t" << p.arrivalTime << "\t" << p.burstTime
-             << "\t\t" << p.completionTime << "\t\t" << p.turnAroundTime
-             << "\t" << p.waitingTime << "\n";
-        totalWT += p.waitingTime;
-        totalTAT += p.turnAroundTime;
+// Ranuras que todavía no terminaron (una instantánea puede traer procesos ya terminados)
+vector<int> ranurasPendientes(const TablaProcesos& tabla) {
+    vector<int> ranuras;
+    ranuras.reserve(tabla.size());
+    for (size_t i = 0; i < tabla.size(); ++i) {
+        if (tabla.dinamico.estado[i] != TERMINADO) ranuras.push_back((int)i);
     }
+    return ranuras;
+}
 
-    // Mostrar promedios finales
-    cout << "\nTiempo promedio de espera: " << (float)totalWT / sjfProcesos.size() << " unidades\n";
-    cout << "Tiempo promedio de retorno: " << (float)totalTAT / sjfProcesos.size() << " unidades\n";
+// Parámetros de planificación del escenario: los de quantum y los que se indiquen explícitamente
+ParametrosPlanificacion parametrosEscenario(const Escenario& esc) {
+    ParametrosPlanificacion parametros = parametrosPorDefecto((int)valorEntero(esc, "quantum", 2));
+    parametros.niveles = (int)valorEntero(esc, "niveles", parametros.niveles);
+    parametros.periodoBoost = valorEntero(esc, "boost", parametros.periodoBoost);
+    parametros.latenciaObjetivo = valorEntero(esc, "latencia", parametros.latenciaObjetivo);
+    parametros.granularidadMinima = valorEntero(esc, "granularidad", parametros.granularidadMinima);
+    return parametros;
+}
 
-    // Actualizar estado de los procesos originales como TERMINADOS
-    for (auto& p : procesos) {
-        if (p.estado != TERMINADO)
-            p.estado = TERMINADO, p.remainingTime = 0;
+// Ejecuta cada planificador sobre una copia nueva del mismo conjunto de procesos
+bool escenarioPlanificacion(const Escenario& esc, vector<RegistroResultado>& registros, string& error) {
+    TablaProcesos base;
+    long long reloj;
+    if (!cargarProcesosEscenario(esc, base, reloj, error)) return false;
+    ParametrosPlanificacion parametros = parametrosEscenario(esc);
+    int quantum = parametros.quantum;
+    ConfigMultinucleo cfg = {(int)valorEntero(esc, "nucleos", 1), valorEntero(esc, "cambio", 0),
+                             valorEntero(esc, "migracion", 0)};
+    if (quantum < 1 || cfg.nucleos < 1 || cfg.cambioContexto < 0 || cfg.migracion < 0) {
+        error = "configuración de planificación inválida";
+        return false;
     }
-}
+    bool real = valorTexto(esc, "ejecucion", "simulada") == "real";
+    ConfigEjecucionReal cfgReal = {(int)valorEntero(esc, "hilos", max(1u, thread::hardware_concurrency())),
+                                   valorEntero(esc, "unidad_us", 1000)};
+    if (real && (cfgReal.hilos < 1 || cfgReal.unidadUs < 1 || cfg.nucleos > 1)) {
+        error = "configuración de ejecución real inválida";
+        return false;
+    }
+    vector<string> politicas = separar(valorTexto(esc, "planificador", "rr"), ',');
+    vector<int> ranuras = ranurasPendientes(base);
 
+    for (size_t i = 0; i < politicas.size(); ++i) {
+        // Una cola de listos por núcleo (una sola en el motor de un núcleo)
+        vector<PoliticaPlanificacion*> colas;
+        for (int k = 0; k < cfg.nucleos; ++k)
+            colas.push_back(crearPoliticaPlanificacion(politicas[i], parametros));
+        if (!colas[0] || (usaMotorMultinucleo(cfg) && colas[0]->expropiativa())) {
+            error = colas[0] ? "política expropiativa no admitida con varios núcleos ni con costos de cambio/migración: " + politicas[i]
+                             : "planificador no disponible: " + politicas[i];
+            for (size_t k = 0; k < colas.size(); ++k) delete colas[k];
+            return false;
+        }
+        PoliticaPlanificacion* politica = colas[0];
 
-// ==== Memoria FIFO ====
-void simularFIFO() {
+        EstadoProcesos estado = base.dinamico;  // Cada corrida parte del mismo estado inicial
+        Corrida c = {base, estado};
 
-    vector<int> pageReferences = {7,0,1,2,0,3,0,4,2,3,0,3,2};
-    int numFrames = 4, pageFaults = 0;
-    unordered_set<int> pageSet;
-    queue<int> pageQueue;
-
-    // Iterar sobre cada referencia de página en la secuencia de acceso
-    for (int page : pageReferences) {
-        //imprimir estado actual de memoria
-        cout << "\n Estado actual de memoria: ";
-        queue<int> tempQueue = pageQueue;  // Crear una copia de la cola para no modificar la original
-        while (!tempQueue.empty()) {
-            cout << tempQueue.front() << " ";
-            tempQueue.pop();
-        }
-        // Verificar si la página ya está en memoria
-        if (pageSet.find(page) == pageSet.end()) {
-            // La página no está en memoria, por lo que hay un fallo de página
-            pageFaults++;
-
-            // Si la memoria está llena (ya hay numFrames páginas en la cola), se debe eliminar la más antigua
-            if (pageQueue.size() == numFrames) {
-                int oldestPage = pageQueue.front(); // Obtener la página más antigua (FIFO)
-                pageQueue.pop();  // Eliminarla de la cola
-                pageSet.erase(oldestPage); // Eliminarla del conjunto de páginas en memoria
-                cout << "\n Página " << oldestPage << " reemplazada por " << page << ".";
-            } else {
-                cout << "\n Página " << page << " cargada en un marco vacío.";
-            }
+        // Ejecución real: los procesos hacen trabajo de CPU en un pool de hilos
+        if (real) {
+            ResultadoEjecucionReal e = PlanificadorReal(c, ranuras, *politica, cfgReal).ejecutar();
+            RegistroResultado r;
+            r.modulo = "ejecucion_real";
+            r.etiqueta("politica", politica->nombre()).metrica("quantum", quantum).metrica("hilos", cfgReal.hilos)
+             .metrica("unidad_us", cfgReal.unidadUs).metrica("procesos", ranuras.size()).metrica("segundos", e.segundos)
+             .metrica("procesos_por_segundo", e.procesosPorSegundo).metrica("unidades_por_segundo", e.unidadesPorSegundo)
+             .metrica("despachos", e.despachos).metrica("latencia_p50_us", e.latenciaP50)
+             .metrica("latencia_p99_us", e.latenciaP99).metrica("cambio_promedio_us", e.cambioPromedioUs);
+            registros.push_back(r);
+            for (size_t k = 0; k < colas.size(); ++k) delete colas[k];
+            continue;
+        }
 
-            // Agregar la nueva página a la cola y al conjunto
-            pageQueue.push(page);
-            pageSet.insert(page);
+        chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+        long long fin;
+        vector<EstadisticasNucleo> nucleos;
+        MetricasPlanificacion m;
+        if (!usaMotorMultinucleo(cfg)) {
+            SimuladorEventos sim(c, ranuras, *politica, reloj);
+            fin = sim.ejecutar();
+            m = sim.resultados();
         } else {
-            // Si la página ya está en memoria, solo informar que no hay fallo de página
-            cout << "\n Página " << page << " ya en memoria.";
+            SimuladorMultinucleo sim(c, ranuras, colas, cfg, reloj);
+            fin = sim.ejecutar();
+            nucleos = sim.estadisticas();
+            m = sim.resultados();
         }
+        double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
 
-        // Imprimir el estado actual de la memoria con el formato deseado
-        cout << "\n Memoria: ";
-        tempQueue = pageQueue;  // Crear una copia de la cola para no modificar la original
-        while (!tempQueue.empty()) {
-            cout << tempQueue.front() << " ";
-            tempQueue.pop();
+        RegistroResultado r;
+        r.modulo = "planificacion";
+        r.etiqueta("politica", politica->nombre()).metrica("quantum", quantum).metrica("procesos", ranuras.size());
+        const HistogramaLog* h[] = {&m.espera, &m.retorno, &m.respuesta};
+        const char* nombres[] = {"espera", "retorno", "respuesta"};
+        for (int k = 0; k < 3; ++k) {
+            string n = nombres[k];
+            r.metrica(n + "_promedio", h[k]->promedio()).metrica(n + "_p50", h[k]->percentil(0.50))
+             .metrica(n + "_p90", h[k]->percentil(0.90)).metrica(n + "_p99", h[k]->percentil(0.99))
+             .metrica(n + "_p999", h[k]->percentil(0.999)).metrica(n + "_max", h[k]->mayor());
         }
-        cout << "| Fallos: " << pageFaults << endl;
+        r.metrica("equidad_jain", indiceEquidad(base, estado, ranuras)).metrica("rendimiento", m.rendimiento())
+         .metrica("utilizacion", m.utilizacion()).metrica("despachos", m.despachos)
+         .metrica("cambios_contexto", m.cambiosContexto).metrica("desalojos", m.desalojos)
+         .metrica("tiempo_final", fin).metrica("segundos", segundos);
+        if (!nucleos.empty()) {
+            long long migraciones = 0, robos = 0, sobrecarga = 0;
+            r.metrica("nucleos", cfg.nucleos);
+            for (size_t k = 0; k < nucleos.size(); ++k) {
+                migraciones += nucleos[k].migraciones;
+                robos += nucleos[k].robos;
+                sobrecarga += nucleos[k].sobrecarga;
+                r.metrica("utilizacion_nucleo_" + to_string(k + 1), fin > 0 ? (double)nucleos[k].ocupado / fin : 0.0);
+            }
+            r.metrica("migraciones", migraciones).metrica("robos", robos).metrica("sobrecarga", sobrecarga);
+        }
+        registros.push_back(r);
+        for (size_t k = 0; k < colas.size(); ++k) delete colas[k];
     }
-
-    // Mostrar el total de fallos de página al final del proceso
-    cout << "\n Total de fallos de página: " << pageFaults << endl;
+    return true;
 }
 
-// ==== Memoria LRU ====
-
-void simularLRU() {
-
-    vector<int> pages = {7,0,1,2,0,3,0,4,2,3,0,3,2};
-    int frames = 4, faults = 0;
-    list<int> memory;
-    unordered_map<int, list<int>::iterator> pos;
-    unordered_map<int, list<int>::iterator> pageMap; // Mapa para rastrear posiciones en la lista
-    int pageFaults = 0; // Contador de fallos de página
-    int frameCount = 4;
-
-    // Recorremos cada página en la secuencia de paginas
-    for (int page : pages) {
-        // Mostrar estado antes de procesar la página
-        cout << "\nProcesando página: " << page << endl;
-        cout << "Estado previo del caché: ";
-        for (int p : memory) cout << p << " "; // Mostramos el contenido actual del caché
-        cout << endl;
-
-        // Si la página ya está en memoria, se mueve al frente más recientemente utilizada
-        if (pageMap.find(page) != pageMap.end()) {
-            memory.erase(pageMap[page]); // Eliminar la página de su posición actual
-            cout << "Página " << page << " ya estaba en memoria (actualizada a más reciente).\n";
-        } else {
-            // Si la memoria está llena, eliminar la página menos utilizada
-            if (memory.size() >= frameCount) {
-                int lruPage = memory.back(); // Página menos utilizada que es la última en la lista
-                memory.pop_back();           // Eliminar de la memoria
-                pageMap.erase(lruPage);      // Quitar del mapa
-                cout << "Página " << lruPage << " reemplazada por " << page << ".\n";
-            }
-            pageFaults++; // Aumentar un fallo de página
-            cout << "Página " << page << " cargada en memoria.\n";
+bool escenarioMemoria(const Escenario& esc, vector<RegistroResultado>& registros, string& error) {
+    string ruta = valorTexto(esc, "traza", "");
+    vector<size_t> marcos = leerListaMarcos(valorTexto(esc, "marcos", "4"));
+    vector<PoliticaReemplazo*> motores;
+    bool optOmitido;
+    bool ok = evaluarTraza(ruta, marcos, motores, optOmitido);
+    if (!ok) error = "no se pudo leer la traza " + ruta;
+    for (size_t i = 0; i < motores.size(); ++i) {
+        const PoliticaReemplazo& m = *motores[i];
+        if (ok) {
+            RegistroResultado r;
+            r.modulo = "memoria";
+            r.etiqueta("politica", m.nombre()).metrica("marcos", m.marcos).metrica("referencias", m.referencias)
+             .metrica("fallos", m.fallos).metrica("tasa_fallos", m.referencias ? (double)m.fallos / m.referencias : 0.0);
+            registros.push_back(r);
         }
-
-        // Agregamos la nueva página al frente de la lista
-        memory.push_front(page);
-        pageMap[page] = memory.begin(); // Actualizamos la posición en el mapa
-
-        // Mostramos el estado actual de la memoria
-        cout << "Estado actual del caché: ";
-        for (int p : memory) cout << p << " "; // Mostramos la memoria después del cambio
-        cout << "| Fallos: " << pageFaults << endl;
+        delete motores[i];
     }
-
-    // Mostrar el total de fallos de página al final
-    cout << "\nTotal de fallos de página: " << pageFaults << endl;
+    return ok;
 }
-// ==== Productor-Consumidor ====
-
-// Recursos compartidos
-mutex mtx;                         // Mutex para proteger el acceso concurrente al buffer
-condition_variable cv;            // Condición para sincronizar productor y consumidor
-queue<int> buffer;                // Buffer compartido (cola de enteros)
-const int BUFFER_SIZE = 5;        // Tamaño máximo del buffer
-bool terminado = false;           // Señal para indicar que el productor ha terminado
-
-/**
- * Función del productor.
- * Inserta 10 elementos en el buffer, esperando si el buffer está lleno.
- */
-void productor() {
-    for (int i = 1; i <= 10; ++i) {
-        unique_lock<mutex> lock(mtx);
 
-        // Esperar mientras el buffer esté lleno
-        cv.wait(lock, [] { return buffer.size() < BUFFER_SIZE; });
-
-        buffer.push(i);
-        cout << "Productor produce: " << i << "\n";
+// Traducción de direcciones: una corrida por cada tamaño de página y cantidad de marcos
+bool escenarioTraduccion(const Escenario& esc, vector<RegistroResultado>& registros, string& error) {
+    string ruta = valorTexto(esc, "traza", "");
+    vector<size_t> bitsPagina = leerListaMarcos(valorTexto(esc, "paginas", "12"));
+    vector<size_t> marcos = leerListaMarcos(valorTexto(esc, "marcos", "1024"));
+    ConfigTraduccion cfg = {(int)valorEntero(esc, "ancho_direccion", 48), 12, (int)valorEntero(esc, "niveles_tabla", 4),
+                            (size_t)valorEntero(esc, "tlb_entradas", 64), (size_t)valorEntero(esc, "tlb_vias", 4),
+                            TLB_LRU, 0, valorTexto(esc, "reemplazo", "LRU")};
+    string reemplazoTLB = valorTexto(esc, "tlb_reemplazo", "lru");
+    for (int i = TLB_LRU; i <= TLB_ALEATORIO; ++i) {
+        if (reemplazoTLB == NOMBRES_REEMPLAZO_TLB[i]) cfg.reemplazoTLB = (ReemplazoTLB)i;
+    }
+    CostosAcceso costos = {(double)valorEntero(esc, "costo_tlb", 1), (double)valorEntero(esc, "costo_memoria", 100),
+                           (double)valorEntero(esc, "costo_fallo", 8000000)};
 
-        cv.notify_all();  // Notificar al consumidor que hay datos
+    vector<TraductorDirecciones*> traductores;
+    bool ok = true;
+    for (size_t i = 0; ok && i < bitsPagina.size(); ++i) {
+        for (size_t j = 0; ok && j < marcos.size(); ++j) {
+            cfg.bitsPagina = (int)bitsPagina[i];
+            cfg.marcos = marcos[j];
+            ok = configTraduccionValida(cfg);
+            if (ok) traductores.push_back(new TraductorDirecciones(cfg));
+        }
     }
+    if (!ok) error = "configuración de traducción inválida";
+    else if (!(ok = procesarTrazaDirecciones(ruta, traductores))) error = "no se pudo leer la traza " + ruta;
 
-    // Indicar que se terminó de producir
-    terminado = true;
-    cv.notify_all();
+    for (size_t i = 0; i < traductores.size(); ++i) {
+        const TraductorDirecciones& t = *traductores[i];
+        if (ok) {
+            RegistroResultado r;
+            r.modulo = "traduccion";
+            r.etiqueta("politica", t.cfg.politicaMarcos).metrica("bits_pagina", t.cfg.bitsPagina)
+             .metrica("niveles", t.cfg.niveles).metrica("marcos", t.cfg.marcos).metrica("alcance_tlb", t.alcanceTLB())
+             .metrica("referencias", t.referencias).metrica("aciertos_tlb", t.aciertosTLB)
+             .metrica("fallos_tlb", t.referencias - t.aciertosTLB).metrica("recorridos", t.recorridos)
+             .metrica("accesos_tabla", t.accesosTabla).metrica("fallos_pagina", t.fallosPagina)
+             .metrica("bytes_tabla", t.tabla.bytes()).metrica("tea_ns", t.tiempoEfectivo(costos));
+            registros.push_back(r);
+        }
+        delete traductores[i];
+    }
+    return ok;
 }
 
-/**
- * Función del consumidor.
- * Consume elementos del buffer mientras no se haya terminado de producir o el buffer esté vacío.
- */
-void consumidor() {
-    while (!terminado || !buffer.empty()) {
-        unique_lock<mutex> lock(mtx);
+// Asignadores de memoria física sobre una traza ("a id bytes" / "f id") o una carga generada
+bool escenarioAsignadores(const Escenario& esc, vector<RegistroResultado>& registros, string& error) {
+    string origen = valorTexto(esc, "asignador", "generar");
+    uint64_t memoria = (uint64_t)valorEntero(esc, "memoria_mib", (long long)(MEMORIA_FISICA_DEFECTO >> 20)) << 20;
+    if (memoria < TAM_PAGINA_FISICA || (memoria & (memoria - 1)) != 0) {
+        error = "memoria_mib debe ser una potencia de 2";
+        return false;
+    }
+    vector<OperacionMemoria> ops;
+    if (origen == "generar") {
+        ConfigCargaMemoria cfg = {(size_t)valorEntero(esc, "operaciones", 1000000), (uint64_t)valorEntero(esc, "semilla", 42),
+                                  (uint32_t)valorEntero(esc, "tam_min", 16), (uint32_t)valorEntero(esc, "tam_max", 8192),
+                                  (size_t)valorEntero(esc, "vivos", 20000)};
+        if (cfg.tamMin < 1 || cfg.tamMax < cfg.tamMin || cfg.vivosMax < 1) {
+            error = "carga de asignación inválida";
+            return false;
+        }
+        ops = generarCargaMemoria(cfg);
+    } else if (!cargarTrazaAsignacion(origen, ops)) {
+        error = "no se pudo leer la traza de asignación " + origen;
+        return false;
+    }
 
-        // Esperar hasta que haya elementos o el productor haya terminado
-        cv.wait(lock, [] { return !buffer.empty() || terminado; });
+    vector<ResultadoAsignador> resultados = compararAsignadores(ops, memoria);
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        const ResultadoAsignador& a = resultados[i];
+        RegistroResultado r;
+        r.modulo = "asignacion";
+        r.etiqueta("asignador", a.nombre).metrica("operaciones", a.operaciones).metrica("fallidas", a.fallidas)
+         .metrica("segundos", a.segundos).metrica("operaciones_por_segundo", a.operacionesPorSegundo)
+         .metrica("reserva_p50_ns", a.latenciaReserva.percentil(0.50))
+         .metrica("reserva_p99_ns", a.latenciaReserva.percentil(0.99))
+         .metrica("liberacion_p50_ns", a.latenciaLiberacion.percentil(0.50))
+         .metrica("liberacion_p99_ns", a.latenciaLiberacion.percentil(0.99))
+         .metrica("fragmentacion_interna", a.fragmentacionInterna)
+         .metrica("fragmentacion_externa", a.fragmentacionExterna).metrica("huella_pico", a.huellaPico);
+        registros.push_back(r);
+    }
+    return true;
+}
 
-        // Consumir todos los elementos disponibles
-        while (!buffer.empty()) {
-            cout << "Consumidor consume: " << buffer.front() << "\n";
-            buffer.pop();
+// Barrido en paralelo: planificación con barrido_quantum y barrido_nucleos (sobre procesos o
+// carga) y reemplazo con barrido_marcos (sobre la traza)
+bool escenarioBarrido(const Escenario& esc, vector<RegistroResultado>& registros, string& error) {
+    if (esc.count("barrido_quantum") || esc.count("barrido_nucleos")) {
+        TablaProcesos base;
+        vector<long long> quantums = leerRango(valorTexto(esc, "barrido_quantum", valorTexto(esc, "quantum", "2")));
+        vector<long long> nucleos = leerRango(valorTexto(esc, "barrido_nucleos", valorTexto(esc, "nucleos", "1")));
+        ConfigMultinucleo costos = {1, valorEntero(esc, "cambio", 0), valorEntero(esc, "migracion", 0)};
+        long long reloj;
+        if (!cargarProcesosEscenario(esc, base, reloj, error)) return false;
+        if (quantums.empty() || nucleos.empty() || costos.cambioContexto < 0 || costos.migracion < 0) {
+            error = "barrido de planificación inválido";
+            return false;
+        }
+        // Los parámetros que no se barren (niveles, boost, latencia, granularidad) son los del escenario
+        ParametrosPlanificacion parametros = parametrosEscenario(esc);
+        vector<string> politicas = separar(valorTexto(esc, "planificador", "rr"), ',');
+        for (size_t i = 0; i < politicas.size(); ++i) {
+            PoliticaPlanificacion* prueba = crearPoliticaPlanificacion(politicas[i], parametros);
+            bool disponible = prueba != nullptr;
+            delete prueba;
+            if (!disponible) {
+                error = "planificador no disponible: " + politicas[i];
+                return false;
+            }
+        }
+        vector<int> ranuras = ranurasPendientes(base);
+        vector<CorridaBarrido> corridas = barridoPlanificacion(base, ranuras, politicas, quantums, nucleos, parametros,
+                                                               costos, reloj);
+        for (size_t i = 0; i < corridas.size(); ++i) {
+            const CorridaBarrido& c = corridas[i];
+            const MetricasPlanificacion& m = c.metricas;
+            RegistroResultado r;
+            r.modulo = "barrido_planificacion";
+            r.etiqueta("politica", c.politica).etiqueta("quantum", to_string(c.quantum))
+             .etiqueta("nucleos", to_string(c.nucleos)).metrica("espera_promedio", m.espera.promedio())
+             .metrica("espera_p99", m.espera.percentil(0.99)).metrica("retorno_p99", m.retorno.percentil(0.99))
+             .metrica("respuesta_p99", m.respuesta.percentil(0.99)).metrica("cambios_contexto", m.cambiosContexto)
+             .metrica("utilizacion", m.utilizacion()).metrica("tiempo_final", c.fin);
+            registros.push_back(r);
         }
+    }
 
-        cv.notify_all();  // Notificar al productor que hay espacio
+    if (esc.count("barrido_marcos")) {
+        vector<long long> marcos = leerRango(valorTexto(esc, "barrido_marcos", ""));
+        string ruta = valorTexto(esc, "traza", "ejemplo");
+        vector<uint64_t> traza = referenciasEjemplo();
+        if (marcos.empty() || (ruta != "ejemplo" && !cargarTraza(ruta, LIMITE_REFERENCIAS_OPT, traza))) {
+            error = "barrido de marcos inválido o traza ilegible: " + ruta;
+            return false;
+        }
+        vector<CorridaReemplazo> corridas = barridoReemplazo(traza, marcos);
+        for (size_t i = 0; i < corridas.size(); ++i) {
+            const CorridaReemplazo& c = corridas[i];
+            RegistroResultado r;
+            r.modulo = "barrido_memoria";
+            r.etiqueta("politica", c.politica).metrica("marcos", c.marcos).metrica("referencias", c.referencias)
+             .metrica("fallos", c.fallos).metrica("tasa_fallos", c.referencias ? (double)c.fallos / c.referencias : 0.0);
+            registros.push_back(r);
+        }
     }
+    return true;
 }
 
-/**
- * Lanza los hilos de productor y consumidor, y espera a que terminen.
- */
-void simularProductorConsumidor() {
-    cout << "\nSimulando Productor-Consumidor...\n";
-    thread prod(productor), cons(consumidor);
-    prod.join();  // Esperar a que el productor termine
-    cons.join();  // Esperar a que el consumidor termine
+// Spooler de impresión en tiempo virtual
+bool escenarioImpresion(const Escenario& esc, vector<RegistroResultado>& registros, string& error) {
+    ConfigImpresion cfg = {(int)valorEntero(esc, "empleados", 10000), (int)valorEntero(esc, "impresoras", 50),
+                           (int)valorEntero(esc, "preparacion_min_ms", 0), (int)valorEntero(esc, "preparacion_max_ms", 600000),
+                           (int)valorEntero(esc, "trabajo_min_ms", 1000), (int)valorEntero(esc, "trabajo_max_ms", 3000),
+                           (int)valorEntero(esc, "documentos", 1), (uint64_t)valorEntero(esc, "semilla", 42)};
+    if (!configImpresionValida(cfg)) {
+        error = "configuración de impresión inválida";
+        return false;
+    }
+    ResultadoImpresionVirtual v = simularImpresionVirtual(cfg);
+    RegistroResultado r;
+    r.modulo = "impresion";
+    r.etiqueta("modo", "virtual").metrica("empleados", cfg.empleados).metrica("impresoras", cfg.impresoras)
+     .metrica("trabajos", v.trabajos).metrica("tiempo_final_ms", v.tiempoFinal)
+     .metrica("espera_promedio_ms", v.espera.promedio()).metrica("espera_p50_ms", v.espera.percentil(0.50))
+     .metrica("espera_p99_ms", v.espera.percentil(0.99)).metrica("espera_max_ms", v.espera.mayor())
+     .metrica("cola_promedio", v.colaPromedio).metrica("cola_maxima", v.colaMaxima)
+     .metrica("utilizacion", utilizacionImpresoras(v)).metrica("segundos", v.segundos);
+    registros.push_back(r);
+    return true;
 }
 
+bool escenarioDisco(const Escenario& esc, vector<RegistroResultado>& registros, string& error) {
+    string ruta = valorTexto(esc, "disco", "");
+    ColaDisco cola;
+    if (ruta == "ejemplo") {
+        int ejemplo[] = {95, 180, 34, 119, 11, 123, 62, 64};
+        cola.solicitudes.assign(ejemplo, ejemplo + sizeof(ejemplo) / sizeof(int));
+        cola.cabeza = 50;
+        cola.cilindros = 200;
+    } else if (!cargarColaDisco(ruta, cola)) {
+        error = "no se pudo cargar la cola de disco " + ruta;
+        return false;
+    }
 
+    vector<ResultadoDisco> resultados = planificarDisco(cola);
+    size_t n = max<size_t>(cola.solicitudes.size(), 1);
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        RegistroResultado r;
+        r.modulo = "disco";
+        r.etiqueta("politica", resultados[i].politica).metrica("solicitudes", cola.solicitudes.size())
+         .metrica("recorrido_total", resultados[i].recorrido).metrica("recorrido_promedio", (double)resultados[i].recorrido / n);
+        registros.push_back(r);
+    }
+    return true;
+}
 
-// ==== Planificación de Disco FCFS / SSTF ====
-// Simula el comportamiento de un disco duro usando los algoritmos FCFS y SSTF
-void simularDisco() {
-
-    // Lista de solicitudes de acceso a pistas del disco
-    vector<int> solicitudes = {95, 180, 34, 119, 11, 123, 62, 64};
-    int cabeza = 50;  // Posición inicial del cabezal del disco
-
-    // --- Algoritmo FCFS (First-Come, First-Served) ---
-    // Atiende las solicitudes en el orden en que llegan
-    cout << "\nSimulación FCFS:\nSecuencia: ";
-    for (int s : solicitudes)
-        cout << s << " ";
-
-    // --- Algoritmo SSTF (Shortest Seek Time First) ---
-    // Atiende la solicitud más cercana a la posición actual del cabezal
-    cout << "\n\nSimulación SSTF:\nSecuencia: ";
-    vector<int> sstf = solicitudes;
-    while (!sstf.empty()) {
-        // Encontrar la solicitud más cercana al cabezal actual
-        auto it = min_element(sstf.begin(), sstf.end(), [cabeza](int a, int b) {
-            return abs(a - cabeza) < abs(b - cabeza);
-        });
+// E/S de bloques en tiempo virtual: io=generar (claves io_*) o la ruta de una traza
+bool escenarioES(const Escenario& esc, vector<RegistroResultado>& registros, string& error) {
+    GeometriaDisco g = GEOMETRIA_DISCO_DEFECTO;
+    g.cilindros = (int)valorEntero(esc, "io_cilindros", g.cilindros);
+    g.rpm = (int)valorEntero(esc, "io_rpm", g.rpm);
+    int maxBloques = (int)valorEntero(esc, "io_lote_max", MAX_BLOQUES_LOTE_ES);
+    if (!geometriaDiscoValida(g) || maxBloques < 1) {
+        error = "geometría de disco inválida";
+        return false;
+    }
 
-        // Mover el cabezal hacia la solicitud seleccionada
-        cout << *it << " ";
-        cabeza = *it;
-        sstf.erase(it);  // Eliminar solicitud atendida
+    string origen = valorTexto(esc, "io", "generar");
+    vector<SolicitudES> solicitudes;
+    if (origen == "generar") {
+        ConfigCargaES cfg = {valorEntero(esc, "io_solicitudes", 100000), (uint64_t)valorEntero(esc, "semilla", 42),
+                             atof(valorTexto(esc, "io_tasa", "150").c_str()), (int)valorEntero(esc, "io_bloques_min", 1),
+                             (int)valorEntero(esc, "io_bloques_max", 32), (int)valorEntero(esc, "io_flujos", 8),
+                             (int)valorEntero(esc, "io_secuencial", 70)};
+        if (cfg.solicitudes < 1 || cfg.tasa <= 0 || cfg.bloquesMin < 1 || cfg.bloquesMax < cfg.bloquesMin ||
+            (uint64_t)cfg.bloquesMax > bloquesDisco(g) || cfg.flujos < 0 || cfg.secuencialPct < 0 || cfg.secuencialPct > 100) {
+            error = "configuración de carga de E/S inválida";
+            return false;
+        }
+        solicitudes = generarCargaES(cfg, g);
+    } else if (!cargarTrazaES(origen, g, solicitudes)) {
+        error = "no se pudo cargar la traza de E/S " + origen;
+        return false;
     }
 
-    cout << "\n";
+    vector<ResultadoES> resultados = compararPoliticasES(solicitudes, g, maxBloques);
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        const ResultadoES& e = resultados[i];
+        RegistroResultado r;
+        r.modulo = "disco_es";
+        r.etiqueta("politica", nombrePoliticaES(e.politica)).etiqueta("fusion", e.fusion ? "si" : "no")
+         .metrica("solicitudes", e.solicitudes).metrica("lotes", e.despachos).metrica("iops", e.iops())
+         .metrica("mb_por_segundo", e.mbPorSegundo()).metrica("utilizacion", e.utilizacion())
+         .metrica("busqueda_ms", e.busqueda / 1e6).metrica("rotacion_ms", e.rotacion / 1e6)
+         .metrica("cola_maxima", e.colaMaxima).metrica("latencia_promedio_us", e.latencia.promedio())
+         .metrica("latencia_p50_us", e.latencia.percentil(0.50)).metrica("latencia_p90_us", e.latencia.percentil(0.90))
+         .metrica("latencia_p99_us", e.latencia.percentil(0.99)).metrica("latencia_p999_us", e.latencia.percentil(0.999))
+         .metrica("latencia_max_us", e.latencia.mayor()).metrica("tiempo_final_ms", e.tiempoFinal / 1e6)
+         .metrica("segundos", e.segundos);
+        registros.push_back(r);
+    }
+    return true;
 }
-// Número total de filósofos (y tenedores)
-const int NUM_FILOSOFOS = 5;
 
-// Cada tenedor se representa con un mutex
-mutex tenedores[NUM_FILOSOFOS];
+bool escenarioBuffers(const Escenario& esc, vector<RegistroResultado>& registros, string& error) {
+    ConfigBenchmarkBuffer cfg;
+    cfg.productores = (int)valorEntero(esc, "productores", 1);
+    cfg.consumidores = (int)valorEntero(esc, "consumidores", 1);
+    cfg.tamBuffer = (size_t)valorEntero(esc, "buffer", 5);
+    cfg.items = (size_t)valorEntero(esc, "items", 0);
+    cfg.lote = (size_t)valorEntero(esc, "lote", 1);
+    if (cfg.productores < 1 || cfg.consumidores < 1 || cfg.tamBuffer < 1 || cfg.lote < 1) {
+        error = "configuración de productor-consumidor inválida";
+        return false;
+    }
 
-/**
- * Función que simula el comportamiento de un filósofo.
- * Cada filósofo alterna entre pensar y comer, asegurando el acceso exclusivo a los tenedores adyacentes.
- */
-void filosofo(int id) {
-    for (int i = 0; i < 3; ++i) {
-        cout << "Filósofo " << id << " está pensando...\n";
-        this_thread::sleep_for(chrono::milliseconds(500));  // Simula tiempo de pensamiento
-
-        int izq = id;                         // Índice del tenedor izquierdo
-        int der = (id + 1) % NUM_FILOSOFOS;   // Índice del tenedor derecho (circular)
-
-        // Para evitar interbloqueos, los filósofos pares toman primero el tenedor izquierdo,
-        // y los impares el derecho. Esto rompe el ciclo de espera circular.
-        if (id % 2 == 0) {
-            lock(tenedores[izq], tenedores[der]);
-            lock_guard<mutex> lockIzq(tenedores[izq], adopt_lock);
-            lock_guard<mutex> lockDer(tenedores[der], adopt_lock);
-        } else {
-            lock(tenedores[der], tenedores[izq]);
-            lock_guard<mutex> lockDer(tenedores[der], adopt_lock);
-            lock_guard<mutex> lockIzq(tenedores[izq], adopt_lock);
-        }
+    vector<ResultadoBenchmarkBuffer> resultados = benchmarkBuffers(cfg);
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        const ResultadoBenchmarkBuffer& b = resultados[i];
+        RegistroResultado r;
+        r.modulo = "productor_consumidor";
+        r.etiqueta("modo", b.modo).metrica("productores", cfg.productores).metrica("consumidores", cfg.consumidores)
+         .metrica("buffer", cfg.tamBuffer).metrica("items_por_segundo", b.itemsPorSegundo)
+         .metrica("latencia_p50_us", b.latenciaP50).metrica("latencia_p90_us", b.latenciaP90)
+         .metrica("latencia_p99_us", b.latenciaP99).metrica("latencia_p999_us", b.latenciaP999);
+        registros.push_back(r);
+    }
+    return true;
+}
 
-        // Sección crítica: el filósofo está comiendo
-        cout << "Filósofo " << id << " está comiendo...\n";
-        this_thread::sleep_for(chrono::milliseconds(500));
+bool escenarioFilosofos(const Escenario& esc, vector<RegistroResultado>& registros, string& error) {
+    ConfigFilosofos cfg = {(int)valorEntero(esc, "filosofos", 5), (int)valorEntero(esc, "comidas", 100), ORDEN_RECURSOS,
+                           (int)valorEntero(esc, "piensa_us", 0), (int)valorEntero(esc, "come_us", 0), false};
+    if (cfg.filosofos < 2 || cfg.comidas < 1 || cfg.piensaUs < 0 || cfg.comeUs < 0) {
+        error = "configuración de filósofos inválida";
+        return false;
+    }
 
-        cout << "Filósofo " << id << " ha terminado de comer.\n";
-        // Al salir del bloque lock_guard, se liberan automáticamente los tenedores
+    EstrategiaFilosofos estrategias[] = {ORDEN_RECURSOS, CAMARERO, CHANDY_MISRA, INTENTO_CON_ESPERA};
+    for (size_t i = 0; i < 4; ++i) {
+        cfg.estrategia = estrategias[i];
+        ResultadoFilosofos f = cenaFilosofos(cfg);
+        RegistroResultado r;
+        r.modulo = "filosofos";
+        r.etiqueta("estrategia", nombreEstrategia(cfg.estrategia)).metrica("filosofos", cfg.filosofos)
+         .metrica("comidas_por_segundo", f.comidasTotales / max(f.segundos, 1e-9))
+         .metrica("comidas_max", f.comidasMax).metrica("comidas_min", f.comidasMin)
+         .metrica("inanicion_max_ms", f.inanicionMaxMs).metrica("contencion", f.contencion);
+        registros.push_back(r);
     }
+    return true;
 }
 
 /**
- * Lanza un hilo por cada filósofo y simula la cena completa.
+ * Punto de entrada del modo sin interfaz. Devuelve el código de salida del programa.
  */
-void simularCenaFilosofos() {
-    cout << "\nSimulando Cena de los Filósofos...\n";
+int ejecutarEscenario(int argc, char* argv[]) {
+    Escenario esc;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        size_t igual = arg.find('=');
+        if (arg.compare(0, 2, "--") != 0 || igual == string::npos) {
+            cerr << "Argumento inválido: " << arg << " (use --clave=valor)\n";
+            return 2;
+        }
+        string clave = arg.substr(2, igual - 2), valor = arg.substr(igual + 1);
+        if (clave == "escenario") {
+            if (!cargarEscenario(valor, esc)) {
+                cerr << "No se pudo leer el escenario " << valor << "\n";
+                return 2;
+            }
+        } else {
+            asignarClave(esc, clave, valor);
+        }
+    }
 
-    vector<thread> filosofos;
+    // Los resultados salen por la salida estándar, así que los eventos solo pueden ir a un archivo
+    modoVisual = false;
+    registro.mostrarEnConsola(false);
+    string nivel = valorTexto(esc, "registro", "resumen");
+    nivelRegistro = REGISTRO_RESUMEN;
+    for (int i = 0; i <= REGISTRO_DETALLE; ++i) {
+        if (nivel == NOMBRES_NIVEL_REGISTRO[i]) nivelRegistro = (NivelRegistro)i;
+    }
+    if (esc.count("registro_archivo") && !registro.guardarEn(esc.find("registro_archivo")->second)) {
+        cerr << "No se pudo crear el archivo de registro\n";
+        return 1;
+    }
+    if (esc.count("traza_chrome") && !trazaChrome.abrir(esc.find("traza_chrome")->second)) {
+        cerr << "No se pudo crear la línea de tiempo\n";
+        return 1;
+    }
 
-    // Crear hilos para cada filósofo
-    for (int i = 0; i < NUM_FILOSOFOS; ++i)
-        filosofos.emplace_back(filosofo, i);
+    vector<RegistroResultado> registros;
+    string error;
+    bool ok = validarClavesEnteras(esc, error);
+    // Con claves de barrido se comparan rangos en paralelo en lugar de una sola corrida
+    bool barrido = esc.count("barrido_quantum") || esc.count("barrido_nucleos") || esc.count("barrido_marcos");
+    if (ok && barrido) ok = escenarioBarrido(esc, registros, error);
+    if (ok && !barrido && (esc.count("procesos") || esc.count("carga") || esc.count("instantanea"))) ok = escenarioPlanificacion(esc, registros, error);
+    if (ok && !barrido && esc.count("traza")) {
+        // Con tamaños de página la traza contiene direcciones virtuales, no números de página
+        if (esc.count("paginas")) ok = escenarioTraduccion(esc, registros, error);
+        else ok = escenarioMemoria(esc, registros, error);
+    }
+    if (ok && esc.count("asignador")) ok = escenarioAsignadores(esc, registros, error);
+    if (ok && esc.count("empleados")) ok = escenarioImpresion(esc, registros, error);
+    if (ok && esc.count("disco")) ok = escenarioDisco(esc, registros, error);
+    if (ok && esc.count("io")) ok = escenarioES(esc, registros, error);
+    if (ok && esc.count("items")) ok = escenarioBuffers(esc, registros, error);
+    if (ok && esc.count("filosofos")) ok = escenarioFilosofos(esc, registros, error);
+    trazaChrome.cerrar();
+    if (!ok) {
+        cerr << "Error en el escenario: " << error << "\n";
+        return 1;
+    }
 
-    // Esperar que todos terminen
-    for (auto& t : filosofos)
-        t.join();
+    string formato = valorTexto(esc, "formato", "json");
+    string rutaSalida = valorTexto(esc, "salida", "");
+    ofstream archivo;
+    if (!rutaSalida.empty()) {
+        archivo.open(rutaSalida.c_str());
+        if (!archivo) {
+            cerr << "No se pudo escribir " << rutaSalida << "\n";
+            return 1;
+        }
+    }
+    ostream& out = rutaSalida.empty() ? cout : archivo;
+    if (formato == "csv") emitirCSV(out, registros);
+    else emitirJSON(out, registros);
+    registro.guardarEn("");
+    // Un error de escritura (disco lleno, tubería cerrada) no debe pasar por una corrida exitosa
+    out.flush();
+    if (archivo.is_open()) archivo.close();
+    if (out.fail()) {
+        cerr << "No se pudieron escribir los resultados" << (rutaSalida.empty() ? "" : " en " + rutaSalida) << "\n";
+        return 1;
+    }
+    return 0;
 }
 
 
@@ -597,16 +6964,18 @@ void mostrarMenu() {
     cout << "2. Ejecutar\n";
     cout << "3. Memoria\n";
     cout << "4. Simular E/S (Impresora)\n";
-    cout << "5. Planificación Disco (FCFS/SSTF)\n";
+    cout << "5. Planificación Disco\n";
     cout << "6. Simular Productor-Consumidor\n";
     cout << "7. Simular Cena de Filósofos\n";
-    cout << "8. Salir\n";
+    cout << "8. Registro de eventos\n";
+    cout << "9. Barrido de parámetros\n";
+    cout << "10. Salir\n";
     cout << "Seleccione opción: ";
 }
 
 /**
  * Muestra un submenú para la gestión de procesos:
- * crear, suspender, reanudar, terminar y ver procesos.
+ * crear, suspender, reanudar, terminar y ver procesos, y guardar o restaurar la tabla.
  */
 void menuGestionProcesos() {
     int opcion;
@@ -619,7 +6988,11 @@ void menuGestionProcesos() {
         cout << "3. Reanudar Proceso\n";
         cout << "4. Terminar Proceso\n";
         cout << "5. Ver Procesos\n";
-        cout << "6. Regresar\n";
+        cout << "6. Generar carga sintética\n";
+        cout << "7. Cambiar prioridad (nice)\n";
+        cout << "8. Guardar instantánea de la tabla\n";
+        cout << "9. Cargar instantánea de la tabla\n";
+        cout << "10. Regresar\n";
         cout << "Seleccione opción: ";
         cin >> opcion;
 
@@ -651,16 +7024,32 @@ void menuGestionProcesos() {
                 mostrarProcesos();
                 break;
             case 6:
+                menuGenerarCarga();
+                break;
+            case 7:
+                cout << "ID del proceso: ";
+                cin >> id;
+                cout << "Nice (" << NICE_MIN << " a " << NICE_MAX << "): ";
+                cin >> tiempo;
+                cambiarNice(id, tiempo);
+                break;
+            case 8:
+                menuGuardarInstantanea();
+                break;
+            case 9:
+                menuCargarInstantanea();
+                break;
+            case 10:
                 break;  // Regresa al menú principal
             default:
                 cout << "Opción inválida.\n";
         }
-    } while (opcion != 6);
+    } while (opcion != 10);
 }
 
 /**
  * Submenú para ejecutar algoritmos de planificación de procesos:
- * Básica, Round Robin y SJF.
+ * Básica, Round Robin, SJF y SRTF, además del modo visual con pausas reales.
  */
 void menuEjecutar() {
     int opcion;
@@ -669,7 +7058,13 @@ void menuEjecutar() {
         cout << "1. Planificación Básica\n";
         cout << "2. Planificación Round Robin\n";
         cout << "3. Planificación SJF\n";
-        cout << "4. Regresar\n";
+        cout << "4. Planificación SRTF (con desalojo)\n";
+        cout << "5. Planificación MLFQ (colas multinivel)\n";
+        cout << "6. Planificación CFS (reparto equitativo por nice)\n";
+        cout << "7. Planificación multinúcleo (RR / SJF)\n";
+        cout << "8. Ejecución real en pool de hilos (RR / SJF)\n";
+        cout << "9. Modo visual: " << (modoVisual ? "activado" : "desactivado") << "\n";
+        cout << "10. Regresar\n";
         cout << "Seleccione opción: ";
         cin >> opcion;
 
@@ -684,16 +7079,37 @@ void menuEjecutar() {
                 ejecutarSJF();
                 break;
             case 4:
+                ejecutarSRTF();
+                break;
+            case 5:
+                ejecutarMLFQ();
+                break;
+            case 6:
+                ejecutarCFS();
+                break;
+            case 7:
+                ejecutarMultinucleo();
+                break;
+            case 8:
+                ejecutarProcesosReal();
+                break;
+            case 9:
+                // Alterna entre máxima velocidad y pausas reales para demostraciones
+                modoVisual = !modoVisual;
+                cout << "Modo visual " << (modoVisual ? "activado" : "desactivado") << ".\n";
+                break;
+            case 10:
                 break;  // Regresar al menú principal
             default:
                 cout << "Opción inválida.\n";
         }
-    } while (opcion != 4);
+    } while (opcion != 10);
 }
 
 /**
  * Submenú para simulación de algoritmos de administración de memoria:
- * FIFO y LRU.
+ * FIFO, LRU, CLOCK, Segunda Oportunidad, ARC y OPT, sobre la secuencia de ejemplo
+ * o sobre una traza en archivo.
  */
 void menuMemoria() {
     int opcion;
@@ -701,10 +7117,22 @@ void menuMemoria() {
         cout << "\n=== Memoria ===\n";
         cout << "1. Memoria FIFO\n";
         cout << "2. Memoria LRU\n";
-        cout << "3. Regresar\n";
+        cout << "3. Memoria CLOCK\n";
+        cout << "4. Memoria Segunda Oportunidad\n";
+        cout << "5. Memoria ARC\n";
+        cout << "6. Memoria OPT (Belady)\n";
+        cout << "7. Simular traza desde archivo (todas las políticas)\n";
+        cout << "8. Curva de fallos LRU (todas las cantidades de marcos)\n";
+        cout << "9. Traducción de direcciones (TLB y tabla multinivel)\n";
+        cout << "10. Asignadores de memoria física (buddy y slab)\n";
+        cout << "11. Regresar\n";
         cout << "Seleccione opción: ";
         cin >> opcion;
 
+        string ruta, listaMarcos;
+        size_t maxMarcos;
+        int reemplazo;
+        ConfigTraduccion cfg = {48, 12, 4, 64, 4, TLB_LRU, 1024, "LRU"};
         switch (opcion) {
             case 1:
                 simularFIFO();
@@ -713,24 +7141,172 @@ void menuMemoria() {
                 simularLRU();
                 break;
             case 3:
+                simularCLOCK();
+                break;
+            case 4:
+                simularSegundaOportunidad();
+                break;
+            case 5:
+                simularARC();
+                break;
+            case 6:
+                simularOPT();
+                break;
+            case 7:
+                cout << "Ruta de la traza: ";
+                cin >> ruta;
+                cout << "Cantidades de marcos (ej. 4,8,16): ";
+                cin >> listaMarcos;
+                simularTrazaArchivo(ruta, leerListaMarcos(listaMarcos));
+                break;
+            case 8:
+                cout << "Ruta de la traza: ";
+                cin >> ruta;
+                cout << "Máximo de marcos: ";
+                cin >> maxMarcos;
+                curvaFallosLRU(ruta, maxMarcos);
+                break;
+            case 9:
+                cout << "Ruta de la traza de direcciones: ";
+                cin >> ruta;
+                cout << "Bits de desplazamiento de página (ej. 12,16,21): ";
+                cin >> listaMarcos;
+                cout << "Niveles de la tabla de páginas: ";
+                cin >> cfg.niveles;
+                cout << "Entradas y vías de la TLB: ";
+                cin >> cfg.entradasTLB >> cfg.viasTLB;
+                cout << "Reemplazo en la TLB (1 = LRU, 2 = FIFO, 3 = aleatorio): ";
+                cin >> reemplazo;
+                cfg.reemplazoTLB = reemplazo == 2 ? TLB_FIFO : reemplazo == 3 ? TLB_ALEATORIO : TLB_LRU;
+                cout << "Marcos físicos (reemplazo LRU): ";
+                cin >> cfg.marcos;
+                simularTraduccion(ruta, leerListaMarcos(listaMarcos), cfg);
+                break;
+            case 10:
+                simularAsignadores();
+                break;
+            case 11:
+                break;  // Regresar al menú principal
+            default:
+                cout << "Opción inválida.\n";
+        }
+    } while (opcion != 11);
+}
+
+/**
+ * Submenú de planificación de disco: cola de ejemplo, cola cargada desde archivo o
+ * E/S de bloques en tiempo virtual (carga generada o traza).
+ */
+void menuDisco() {
+    int opcion;
+    do {
+        cout << "\n=== Planificación Disco ===\n";
+        cout << "1. Cola de ejemplo\n";
+        cout << "2. Cargar cola desde archivo\n";
+        cout << "3. E/S temporizada con carga generada\n";
+        cout << "4. E/S temporizada desde traza\n";
+        cout << "5. Regresar\n";
+        cout << "Seleccione opción: ";
+        cin >> opcion;
+
+        string ruta;
+        switch (opcion) {
+            case 1:
+                simularDisco();
+                break;
+            case 2:
+                cout << "Ruta del archivo (cabeza, cilindros, solicitudes...): ";
+                cin >> ruta;
+                simularDiscoArchivo(ruta);
+                break;
+            case 3:
+                simularESTemporizada(false);
+                break;
+            case 4:
+                simularESTemporizada(true);
+                break;
+            case 5:
                 break;  // Regresar al menú principal
             default:
                 cout << "Opción inválida.\n";
         }
-    } while (opcion != 3);
+    } while (opcion != 5);
 }
 
 
-int main() {
+/**
+ * Submenú del registro de eventos: nivel de detalle, destino de los eventos,
+ * decodificación de archivos binarios guardados antes y exportación de la línea de tiempo.
+ */
+void menuRegistro() {
+    int opcion;
+    do {
+        cout << "\n--- Registro de eventos ---\n";
+        cout << "1. Nivel (actual: " << NOMBRES_NIVEL_REGISTRO[nivelRegistro] << ")\n";
+        cout << "2. Mostrar eventos en consola: " << (registro.enConsola() ? "sí" : "no") << "\n";
+        cout << "3. Guardar eventos en archivo binario" << (registro.guardando() ? " (guardando)" : "") << "\n";
+        cout << "4. Decodificar archivo de eventos\n";
+        cout << "5. Exportar línea de tiempo (Chrome/Perfetto)" << (trazaChrome.activa() ? " (exportando)" : "") << "\n";
+        cout << "6. Regresar\n";
+        cout << "Seleccione opción: ";
+        cin >> opcion;
+
+        switch (opcion) {
+            case 1: {
+                int nivel;
+                cout << "0 = resumen, 1 = eventos, 2 = detalle: ";
+                cin >> nivel;
+                if (nivel >= REGISTRO_RESUMEN && nivel <= REGISTRO_DETALLE) nivelRegistro = (NivelRegistro)nivel;
+                else cout << "Nivel inválido.\n";
+                break;
+            }
+            case 2:
+                registro.mostrarEnConsola(!registro.enConsola());
+                break;
+            case 3: {
+                string ruta;
+                cout << "Ruta del archivo (- para dejar de guardar): ";
+                cin >> ruta;
+                if (!registro.guardarEn(ruta == "-" ? "" : ruta))
+                    cout << "No se pudo crear el archivo.\n";
+                break;
+            }
+            case 4: {
+                string ruta;
+                cout << "Ruta del archivo: ";
+                cin >> ruta;
+                if (!decodificarRegistro(ruta, cout))
+                    cout << "El archivo no es un registro de eventos válido.\n";
+                break;
+            }
+            case 5: {
+                // Las simulaciones siguientes se agregan al mismo archivo hasta cerrarlo con "-"
+                string ruta;
+                cout << "Ruta del archivo .json (- para terminar la exportación): ";
+                cin >> ruta;
+                if (ruta == "-") trazaChrome.cerrar();
+                else if (!trazaChrome.abrir(ruta)) cout << "No se pudo crear el archivo.\n";
+                break;
+            }
+            case 6:
+                break;
+            default:
+                cout << "Opción inválida.\n";
+        }
+    } while (opcion != 6);
+}
+
+int main(int argc, char* argv[]) {
+    // Con argumentos se ejecuta un escenario sin menú interactivo
+    if (argc > 1)
+        return ejecutarEscenario(argc, argv);
+
     // Configuración para permitir la salida en UTF-8 en consola de Windows (comentada actualmente)
     //SetConsoleOutputCP(CP_UTF8);
     //SetConsoleCP(CP_UTF8);
     //std::locale::global(std::locale(""));
     //std::wcout.imbue(std::locale(""));
 
-    std::vector<std::thread> hilos;           // Vector para almacenar los hilos del sistema de impresión
-    srand(time(nullptr));                     // Inicializa la semilla para generar números aleatorios
-    const int num_empleados = 5;              // Número de empleados para el sistema de impresión
     int opcion;                               // Variable para guardar la opción del menú
 
     do {
@@ -749,30 +7325,30 @@ int main() {
                 break;
             case 4:
                 // Simulación del sistema de impresión compartida usando múltiples hilos
-                std::cout << "=== SISTEMA DE IMPRESION COMPARTIDA ===\n";
-                for (int i = 1; i <= num_empleados; ++i) {
-                    hilos.emplace_back(empleado, i);  // Crea un hilo por cada empleado
-                }
-                for (auto& t : hilos) {
-                    t.join();                         // Espera que todos los hilos terminen
-                }
+                menuImpresion();
                 break;
             case 5:
-                simularDisco();               // Simula el acceso a disco usando algoritmos FCFS y SSTF
+                menuDisco();                  // Simula el acceso a disco (FCFS, SSTF, SCAN, C-SCAN, LOOK, C-LOOK)
                 break;
             case 6:
-                simularProductorConsumidor(); // Ejecuta la simulación del problema productor-consumidor
+                menuProductorConsumidor();    // Simulación productor-consumidor y benchmark de buffers
                 break;
             case 7:
-                simularCenaFilosofos();       // Ejecuta la simulación de la cena de los filósofos
+                menuFilosofos();              // Cena de los filósofos y benchmark de estrategias
                 break;
             case 8:
+                menuRegistro();               // Nivel del registro de eventos, archivo binario y decodificador
+                break;
+            case 9:
+                menuBarrido();                // Compara quantums, núcleos y marcos en paralelo
+                break;
+            case 10:
                 cout << "¡Gracias por usar nuestro Sistema Operativo!\n"; // Mensaje de despedida
                 break;
             default:
                 cout << L"La opción es inválida, por favor intenta de nuevo.\n"; // Opción no válida
         }
-    } while (opcion != 8); // Repite mientras no se elija salir (opción 8)
+    } while (opcion != 10); // Repite mientras no se elija salir (opción 10)
 
     return 0; // Fin del programa
 }